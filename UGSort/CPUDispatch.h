@@ -0,0 +1,960 @@
+#pragma once
+//*******************************************************************************************************************
+//*																													*
+//*   File:       CPUDispatch.h																						*
+//*   Suite:      Experimental Algorithms																			*
+//*   Version:    1.40.0	(Build: 44)																				*
+//*   Author:     Ian Tree/HMNL																						*
+//*																													*
+//*   Copyright 2017 - 2026 Ian J. Tree																				*
+//*******************************************************************************************************************
+//*																													*
+//*	This header file contains the definition for the CPUDispatch class.												*
+//* The CPUDispatch class detects the vector instruction set extensions of the processor at startup and selects		*
+//* the implementation of each dispatched kernel for the chosen kernel level. A single binary therefore runs on		*
+//* any x86-64 processor and uses the widest kernels that the processor (and operating system) supports.			*
+//*																													*
+//*	LEVELS:																											*
+//*																													*
+//*	scalar		-	Portable kernels, no vector extensions are used.												*
+//*	sse4.2		-	SSE4.2 kernels (16 byte vectors, string compare instructions).									*
+//*	avx2		-	AVX2 kernels (32 byte vectors).																	*
+//*	avx512		-	AVX-512 (F and BW) kernels (64 byte vectors with mask registers).								*
+//*																													*
+//*	NOTES:																											*
+//*																													*
+//*	1.	The level is selected once before the sort starts, a forced level above the detected level is lowered		*
+//*		to the detected level.																						*
+//*	2.	Vector kernels are compiled with per-function target attributes, the remainder of the application is		*
+//*		built for the baseline architecture.																		*
+//*	3.	On processors other than x86-64 only the scalar level is available.											*
+//*	4.	Vector scans load whole aligned blocks, bytes either side of the scanned text within the same block are		*
+//*		read. The sort input image is allocated on a 64 byte boundary with its length padded to a multiple of 64	*
+//*		bytes (see Sorter::allocImage()) so that every block read lies within the image.							*
+//*	5.	The selected kernels are called through function pointers set by select(), the level is never tested per	*
+//*		call. getKernels() describes the selection (logged at startup).												*
+//*																													*
+//*******************************************************************************************************************
+//*																													*
+//*   History:																										*
+//*																													*
+//*	1.40.0 -	16/10/2026	-	Initial Release																		*
+//*																													*
+//*******************************************************************************************************************/
+
+//  Include xymorg headers
+#include	"../xymorg/xymorg.h"															//  xymorg system headers
+
+//  Platform vector extensions
+#if (defined(__x86_64__) || defined(_M_X64))
+#define		CPUD_X64
+#include	<immintrin.h>
+#if (defined(_MSC_VER))
+#include	<intrin.h>
+#endif
+#endif
+
+//  Per-function target selection (MSVC accepts any intrinsic in any function)
+#if (defined(CPUD_X64) && (defined(__GNUC__) || defined(__clang__)))
+#define		CPUD_TARGET(T)		__attribute__((target(T)))
+#else
+#define		CPUD_TARGET(T)
+#endif
+
+//  Kernel levels
+#define		ISA_AUTO			-1															//  Highest detected level
+#define		ISA_SCALAR			0															//  Portable kernels
+#define		ISA_SSE42			1															//  SSE4.2 kernels
+#define		ISA_AVX2			2															//  AVX2 kernels
+#define		ISA_AVX512			3															//  AVX-512 (F and BW) kernels
+
+//  Prefix merge kernel limits
+#define		PFXMERGE_MAXRECL	32															//  Largest sort record handled by the prefix merge kernels
+#define		PFXMERGE_RUN		8															//  Records taken from one range that end a vector merge
+
+//  countTrailingZeros
+//
+//  Returns the number of trailing zero bits in a non-zero word
+//
+//  PARAMETERS:
+//
+//		uint64_t		-		The word (MUST be non-zero)
+//
+//  RETURNS:
+//
+//		size_t			-		Index of the lowest set bit
+//
+//  NOTES:
+//
+
+inline size_t	countTrailingZeros(uint64_t Word) {
+#if (defined(_MSC_VER))
+	unsigned long	Index = 0;																	//  Bit index
+
+	_BitScanForward64(&Index, Word);
+	return size_t(Index);
+#else
+	return size_t(__builtin_ctzll(Word));
+#endif
+}
+
+//
+//		CPUDispatch Class definition
+//
+
+class CPUDispatch {
+public:
+
+	//*******************************************************************************************************************
+	//*                                                                                                                 *
+	//*   Public Types			                                                                                        *
+	//*                                                                                                                 *
+	//*******************************************************************************************************************
+
+	//  Merge kernel for sort records holding an inline key prefix (see mergePfxAVX2())
+	typedef void (*PfxMerger)(const char*& pA, const char* pAEnd, const char*& pB, const char* pBEnd, char*& pOut, size_t RecLen, size_t PfxOff);
+
+	//*******************************************************************************************************************
+	//*                                                                                                                 *
+	//*   Public Functions                                                                                              *
+	//*                                                                                                                 *
+	//*******************************************************************************************************************
+
+	//  select
+	//
+	//  Detects the processor features and selects the kernels for the requested level
+	//
+	//  PARAMETERS:
+	//
+	//		int				-		Requested level (ISA_xxx), ISA_AUTO selects the highest detected level
+	//
+	//  RETURNS:
+	//
+	//		int				-		The selected level
+	//
+	//  NOTES:
+	//
+	//	1.	Every dispatched kernel is selected here, the kernels are never selected per call. A kernel without an
+	//		implementation at the selected level uses the implementation for the next lower level.
+	//
+
+	static int	select(int Requested) {
+		int			Level = getDetected();															//  Selected level
+		int			ScanLevel = ISA_SCALAR;															//  Level of the newline scanner
+		int			CompareLevel = ISA_SCALAR;														//  Level of the key compare kernel
+		int			MergeLevel = ISA_SCALAR;														//  Level of the prefix merge kernel
+
+		if ((Requested != ISA_AUTO) && (Requested < Level)) Level = Requested;
+		level() = Level;
+
+		//  Select the newline scanner
+		switch (Level) {
+#ifdef CPUD_X64
+		case ISA_AVX512: scanner() = findLFAVX512; ScanLevel = ISA_AVX512; break;
+		case ISA_AVX2: scanner() = findLFAVX2; ScanLevel = ISA_AVX2; break;
+		case ISA_SSE42: scanner() = findLFSSE42; ScanLevel = ISA_SSE42; break;
+#endif
+		default: scanner() = findLFScalar; break;
+		}
+
+		//  Select the key compare kernel
+		switch (Level) {
+#ifdef CPUD_X64
+		case ISA_AVX512:
+		case ISA_AVX2: comparer() = compareBlocksAVX2; CompareLevel = ISA_AVX2; break;
+		case ISA_SSE42: comparer() = compareBlocksSSE42; CompareLevel = ISA_SSE42; break;
+#endif
+		default: comparer() = compareBlocksScalar; break;
+		}
+
+		//  Select the prefix merge kernel, the scalar level merges record by record
+		switch (Level) {
+#ifdef CPUD_X64
+		case ISA_AVX512:
+		case ISA_AVX2: merger() = mergePfxAVX2; MergeLevel = ISA_AVX2; break;
+		case ISA_SSE42: merger() = mergePfxSSE42; MergeLevel = ISA_SSE42; break;
+#endif
+		default: merger() = nullptr; break;
+		}
+
+		//  Describe the selected kernels
+		kernels() = std::string("scan: ") + getLevelName(ScanLevel) + ", compare: " + getLevelName(CompareLevel) + ", merge: " + getLevelName(MergeLevel);
+
+		//  Return the selected level
+		return Level;
+	}
+
+	//  getLevel
+	//
+	//  Returns the selected kernel level
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//		int				-		The selected level (ISA_xxx)
+	//
+	//  NOTES:
+	//
+
+	static int	getLevel() { return level(); }
+
+	//  getDetected
+	//
+	//  Returns the highest kernel level supported by the processor and operating system
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//		int				-		The detected level (ISA_xxx)
+	//
+	//  NOTES:
+	//
+	//	1.	Detection is performed on the first call only.
+	//
+
+	static int	getDetected() {
+		static int		Detected = detect();														//  Detected level
+
+		return Detected;
+	}
+
+	//  setLevel
+	//
+	//  Parses the passed level name
+	//
+	//  PARAMETERS:
+	//
+	//		char*			-		Const pointer to the level name
+	//		size_t			-		Length of the name
+	//		int&			-		Reference to the level to be set
+	//
+	//  RETURNS:
+	//
+	//		bool			-		true if the name is a valid level, otherwise false
+	//
+	//  NOTES:
+	//
+
+	static bool	setLevel(const char* pName, size_t NameLen, int& Level) {
+
+		for (int lIndex = ISA_AUTO; lIndex <= ISA_AVX512; lIndex++) {
+			if (NameLen == strlen(getLevelName(lIndex)) && _memicmp(pName, getLevelName(lIndex), NameLen) == 0) {
+				Level = lIndex;
+				return true;
+			}
+		}
+
+		//  Return showing an invalid level
+		return false;
+	}
+
+	//  getLevelName
+	//
+	//  Returns the name of the passed level
+	//
+	//  PARAMETERS:
+	//
+	//		int				-		Level (ISA_xxx)
+	//
+	//  RETURNS:
+	//
+	//		char*			-		Const pointer to the name of the level
+	//
+	//  NOTES:
+	//
+
+	static const char* getLevelName(int Level) {
+		switch (Level) {
+		case ISA_AUTO: return "auto";
+		case ISA_SCALAR: return "scalar";
+		case ISA_SSE42: return "sse4.2";
+		case ISA_AVX2: return "avx2";
+		case ISA_AVX512: return "avx512";
+		}
+		return "unknown";
+	}
+
+	//  getFeatures
+	//
+	//  Returns the list of the detected processor features
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//		std::string		-		Space separated feature names ("none" if no vector extensions were detected)
+	//
+	//  NOTES:
+	//
+
+	static std::string	getFeatures() {
+		std::string		Features;																	//  Feature list
+
+		for (int lIndex = ISA_SSE42; lIndex <= getDetected(); lIndex++) {
+			if (!Features.empty()) Features += " ";
+			Features += getLevelName(lIndex);
+		}
+		if (Features.empty()) Features = "none";
+		return Features;
+	}
+
+	//  getKernels
+	//
+	//  Returns a description of the kernel selected for each dispatched function
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//		std::string&	-		Const reference to the description ("scan: l, compare: l, merge: l")
+	//
+	//  NOTES:
+	//
+
+	static const std::string&	getKernels() { return kernels(); }
+
+	//  findLF
+	//
+	//  Locates the next line feed in a null terminated text (dispatched strchr(pText, SCHAR_LF))
+	//
+	//  PARAMETERS:
+	//
+	//		char*			-		Const pointer to the text
+	//
+	//  RETURNS:
+	//
+	//		char*			-		Const pointer to the line feed, nullptr if the terminator is reached first
+	//
+	//  NOTES:
+	//
+	//	1.	As for strchr() the non-const overload returns a non-const pointer.
+	//
+
+	static const char* findLF(const char* pText) { return scanner()(pText); }
+	static char* findLF(char* pText) { return const_cast<char*>(scanner()(pText)); }
+
+	//  getPrefixMerger
+	//
+	//  Returns the selected merge kernel for sort records holding an inline key prefix
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//		PfxMerger		-		The selected kernel, nullptr if the records are merged record by record
+	//
+	//  NOTES:
+	//
+
+	static PfxMerger	getPrefixMerger() { return merger(); }
+
+	//  compareKeyBlocks
+	//
+	//  Compares two keys of at least 16 bytes with the selected key compare kernel
+	//
+	//  PARAMETERS:
+	//
+	//		char*			-		Const pointer to the first key
+	//		char*			-		Const pointer to the second key
+	//		size_t			-		Length of the keys (at least 16 bytes)
+	//
+	//  RETURNS:
+	//
+	//		int				-		<0, 0 or >0 as the first key is below, equal to or above the second key (memcmp semantics)
+	//
+	//  NOTES:
+	//
+
+	static int	compareKeyBlocks(const char* pA, const char* pB, size_t KL) { return comparer()(pA, pB, KL); }
+
+private:
+
+	//*******************************************************************************************************************
+	//*                                                                                                                 *
+	//*   Private Types			                                                                                        *
+	//*                                                                                                                 *
+	//*******************************************************************************************************************
+
+	typedef const char* (*LFScanner)(const char*);												//  Newline scanner kernel
+	typedef int (*KeyComparer)(const char*, const char*, size_t);								//  Key compare kernel
+
+	//*******************************************************************************************************************
+	//*                                                                                                                 *
+	//*   Private Functions                                                                                             *
+	//*                                                                                                                 *
+	//*******************************************************************************************************************
+
+	//  level
+	//
+	//  Returns a reference to the selected level
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//		int&			-		Reference to the selected level
+	//
+	//  NOTES:
+	//
+
+	static int& level() {
+		static int		Level = ISA_SCALAR;															//  Selected level
+
+		return Level;
+	}
+
+	//  scanner
+	//
+	//  Returns a reference to the selected newline scanner
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//		LFScanner&		-		Reference to the selected scanner
+	//
+	//  NOTES:
+	//
+
+	static LFScanner& scanner() {
+		static LFScanner	pScanner = findLFScalar;												//  Selected scanner
+
+		return pScanner;
+	}
+
+	//  comparer
+	//
+	//  Returns a reference to the selected key compare kernel
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//		KeyComparer&	-		Reference to the selected kernel
+	//
+	//  NOTES:
+	//
+
+	static KeyComparer& comparer() {
+		static KeyComparer	pComparer = compareBlocksScalar;										//  Selected kernel
+
+		return pComparer;
+	}
+
+	//  kernels
+	//
+	//  Returns a reference to the description of the selected kernels
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//		std::string&	-		Reference to the description
+	//
+	//  NOTES:
+	//
+
+	static std::string& kernels() {
+		static std::string	Kernels = "scan: scalar, compare: scalar, merge: scalar";			//  Selected kernels
+
+		return Kernels;
+	}
+
+	//  merger
+	//
+	//  Returns a reference to the selected prefix merge kernel
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//		PfxMerger&		-		Reference to the selected kernel
+	//
+	//  NOTES:
+	//
+
+	static PfxMerger& merger() {
+		static PfxMerger	pMerger = nullptr;														//  Selected kernel
+
+		return pMerger;
+	}
+
+	//  loadPrefix
+	//
+	//  Returns the key prefix held at the passed address of a sort record
+	//
+	//  PARAMETERS:
+	//
+	//		char*			-		Const pointer to the key prefix
+	//
+	//  RETURNS:
+	//
+	//		long long		-		The key prefix biased by the sign bit (unsigned order under signed compares)
+	//
+	//  NOTES:
+	//
+
+	static long long	loadPrefix(const char* pPfx) {
+		uint64_t		Prefix = 0;																	//  Key prefix
+
+		memcpy(&Prefix, pPfx, 8);
+		return (long long) (Prefix ^ (uint64_t(1) << 63));
+	}
+
+	//  detect
+	//
+	//  Determines the highest kernel level supported by the processor and operating system
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//		int				-		The detected level (ISA_xxx)
+	//
+	//  NOTES:
+	//
+	//	1.	The AVX levels also require the operating system to save the extended register state (XCR0).
+	//
+
+	static int	detect() {
+#if (defined(CPUD_X64) && defined(_MSC_VER))
+		int				Regs[4] = {};																//  CPUID registers
+		bool			SSE42 = false;																//  SSE4.2 supported
+		bool			AVX = false;																//  AVX state enabled
+		bool			AVX512State = false;														//  AVX-512 state enabled
+
+		__cpuid(Regs, 1);
+		SSE42 = (Regs[2] & (1 << 20)) != 0;
+		if ((Regs[2] & (1 << 27)) != 0 && (Regs[2] & (1 << 28)) != 0) {
+			unsigned __int64	XCR0 = _xgetbv(0);													//  Enabled register state
+
+			AVX = (XCR0 & 0x06) == 0x06;
+			AVX512State = (XCR0 & 0xE6) == 0xE6;
+		}
+		__cpuidex(Regs, 7, 0);
+		if (AVX512State && (Regs[1] & (1 << 16)) != 0 && (Regs[1] & (1 << 30)) != 0) return ISA_AVX512;
+		if (AVX && (Regs[1] & (1 << 5)) != 0) return ISA_AVX2;
+		if (SSE42) return ISA_SSE42;
+		return ISA_SCALAR;
+#elif (defined(CPUD_X64))
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) return ISA_AVX512;
+		if (__builtin_cpu_supports("avx2")) return ISA_AVX2;
+		if (__builtin_cpu_supports("sse4.2")) return ISA_SSE42;
+		return ISA_SCALAR;
+#else
+		return ISA_SCALAR;
+#endif
+	}
+
+	//  findLFScalar
+	//
+	//  Scalar newline scanner
+	//
+	//  PARAMETERS:
+	//
+	//		char*			-		Const pointer to the text
+	//
+	//  RETURNS:
+	//
+	//		char*			-		Const pointer to the line feed, nullptr if the terminator is reached first
+	//
+	//  NOTES:
+	//
+
+	static const char* findLFScalar(const char* pText) { return strchr(pText, SCHAR_LF); }
+
+	//  compareBlocksScalar
+	//
+	//  Scalar key compare kernel
+	//
+	//  PARAMETERS:
+	//
+	//		char*			-		Const pointer to the first key
+	//		char*			-		Const pointer to the second key
+	//		size_t			-		Length of the keys
+	//
+	//  RETURNS:
+	//
+	//		int				-		<0, 0 or >0 as the first key is below, equal to or above the second key (memcmp semantics)
+	//
+	//  NOTES:
+	//
+
+	static int	compareBlocksScalar(const char* pA, const char* pB, size_t KL) { return memcmp(pA, pB, KL); }
+
+#ifdef CPUD_X64
+
+	//  findLFSSE42
+	//
+	//  SSE4.2 newline scanner
+	//
+	//  PARAMETERS:
+	//
+	//		char*			-		Const pointer to the text
+	//
+	//  RETURNS:
+	//
+	//		char*			-		Const pointer to the line feed, nullptr if the terminator is reached first
+	//
+	//  NOTES:
+	//
+	//	1.	The implicit length string compare stops at the terminator, a match beyond it is never reported.
+	//
+
+	CPUD_TARGET("sse4.2")
+	static const char* findLFSSE42(const char* pText) {
+		const __m128i	LF = _mm_cvtsi32_si128(SCHAR_LF);											//  Search set
+		const int		Mode = _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_LEAST_SIGNIFICANT;		//  Compare mode
+		__m128i			Block;																		//  Block of text
+		int				Index = 0;																	//  Index of the line feed in the block
+
+		//  Scan up to the first aligned block
+		while ((uintptr_t(pText) & 15) != 0) {
+			if (*pText == SCHAR_LF) return pText;
+			if (*pText == '\0') return nullptr;
+			pText++;
+		}
+
+		//  Scan each aligned block
+		for (;;) {
+			Block = _mm_load_si128((const __m128i*) pText);
+			Index = _mm_cmpistri(LF, Block, Mode);
+			if (Index < 16) return pText + Index;
+			if (_mm_cmpistrz(LF, Block, Mode)) return nullptr;
+			pText += 16;
+		}
+	}
+
+	//  findLFAVX2
+	//
+	//  AVX2 newline scanner
+	//
+	//  PARAMETERS:
+	//
+	//		char*			-		Const pointer to the text
+	//
+	//  RETURNS:
+	//
+	//		char*			-		Const pointer to the line feed, nullptr if the terminator is reached first
+	//
+	//  NOTES:
+	//
+	//	1.	Line feeds and terminators are matched together, the first match decides the result.
+	//
+
+	CPUD_TARGET("avx2")
+	static const char* findLFAVX2(const char* pText) {
+		const __m256i	LF = _mm256_set1_epi8(SCHAR_LF);											//  Line feeds
+		const __m256i	NUL = _mm256_setzero_si256();												//  Terminators
+		const char*		pBlock = (const char*) (uintptr_t(pText) & ~uintptr_t(31));					//  Aligned block
+		__m256i			Block = _mm256_load_si256((const __m256i*) pBlock);							//  Block of text
+		uint64_t		Mask = 0;																	//  Match mask
+
+		//  The leading bytes of the first block precede the text
+		Mask = uint32_t(_mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(Block, LF), _mm256_cmpeq_epi8(Block, NUL))));
+		Mask &= ~uint64_t(0) << (pText - pBlock);
+
+		//  Scan until a block holds a match
+		while (Mask == 0) {
+			pBlock += 32;
+			Block = _mm256_load_si256((const __m256i*) pBlock);
+			Mask = uint32_t(_mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(Block, LF), _mm256_cmpeq_epi8(Block, NUL))));
+		}
+
+		pBlock += countTrailingZeros(Mask);
+		return (*pBlock == SCHAR_LF) ? pBlock : nullptr;
+	}
+
+	//  findLFAVX512
+	//
+	//  AVX-512 newline scanner
+	//
+	//  PARAMETERS:
+	//
+	//		char*			-		Const pointer to the text
+	//
+	//  RETURNS:
+	//
+	//		char*			-		Const pointer to the line feed, nullptr if the terminator is reached first
+	//
+	//  NOTES:
+	//
+	//	1.	Line feeds and terminators are matched together, the first match decides the result.
+	//
+
+	CPUD_TARGET("avx512f,avx512bw")
+	static const char* findLFAVX512(const char* pText) {
+		const __m512i	LF = _mm512_set1_epi8(SCHAR_LF);											//  Line feeds
+		const __m512i	NUL = _mm512_setzero_si512();												//  Terminators
+		const char*		pBlock = (const char*) (uintptr_t(pText) & ~uintptr_t(63));					//  Aligned block
+		__m512i			Block = _mm512_load_si512((const void*) pBlock);							//  Block of text
+		uint64_t		Mask = 0;																	//  Match mask
+
+		//  The leading bytes of the first block precede the text
+		Mask = _mm512_cmpeq_epi8_mask(Block, LF) | _mm512_cmpeq_epi8_mask(Block, NUL);
+		Mask &= ~uint64_t(0) << (pText - pBlock);
+
+		//  Scan until a block holds a match
+		while (Mask == 0) {
+			pBlock += 64;
+			Block = _mm512_load_si512((const void*) pBlock);
+			Mask = _mm512_cmpeq_epi8_mask(Block, LF) | _mm512_cmpeq_epi8_mask(Block, NUL);
+		}
+
+		pBlock += countTrailingZeros(Mask);
+		return (*pBlock == SCHAR_LF) ? pBlock : nullptr;
+	}
+
+	//  compareBlocksSSE42
+	//
+	//  SSE4.2 key compare kernel, compares 16 byte blocks with vector equality masks
+	//
+	//  PARAMETERS:
+	//
+	//		char*			-		Const pointer to the first key
+	//		char*			-		Const pointer to the second key
+	//		size_t			-		Length of the keys (at least 16 bytes)
+	//
+	//  RETURNS:
+	//
+	//		int				-		<0, 0 or >0 as the first key is below, equal to or above the second key (memcmp semantics)
+	//
+	//  NOTES:
+	//
+	//	1.	The first differing byte is located from the inequality mask of the block (count trailing zeros) and the
+	//		two bytes are compared unsigned, every byte ahead of it is equal so the result is identical to memcmp().
+	//	2.	The last block overlaps the previous block when the length is not a multiple of 16.
+	//
+
+	CPUD_TARGET("sse4.2")
+	static int	compareBlocksSSE42(const char* pA, const char* pB, size_t KL) {
+		size_t			Off = 0;																	//  Offset of the block
+		uint32_t		Diff = 0;																	//  Inequality mask
+
+		for (;;) {
+			if ((Off + 16) > KL) Off = KL - 16;
+			Diff = uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*) (pA + Off)), _mm_loadu_si128((const __m128i*) (pB + Off))))) ^ 0xFFFF;
+			if (Diff != 0) {
+				Off += countTrailingZeros(Diff);
+				return ((unsigned char) pA[Off] < (unsigned char) pB[Off]) ? -1 : 1;
+			}
+			if ((Off + 16) >= KL) return 0;
+			Off += 16;
+		}
+	}
+
+	//  compareBlocksAVX2
+	//
+	//  AVX2 key compare kernel, compares 32 byte blocks with vector equality masks
+	//
+	//  PARAMETERS:
+	//
+	//		char*			-		Const pointer to the first key
+	//		char*			-		Const pointer to the second key
+	//		size_t			-		Length of the keys (at least 16 bytes)
+	//
+	//  RETURNS:
+	//
+	//		int				-		<0, 0 or >0 as the first key is below, equal to or above the second key (memcmp semantics)
+	//
+	//  NOTES:
+	//
+	//	1.	The 32 byte form of compareBlocksSSE42(), keys shorter than 32 bytes are compared by compareBlocksSSE42().
+	//
+
+	CPUD_TARGET("avx2")
+	static int	compareBlocksAVX2(const char* pA, const char* pB, size_t KL) {
+		size_t			Off = 0;																	//  Offset of the block
+		uint32_t		Diff = 0;																	//  Inequality mask
+
+		if (KL < 32) return compareBlocksSSE42(pA, pB, KL);
+		for (;;) {
+			if ((Off + 32) > KL) Off = KL - 32;
+			Diff = ~uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*) (pA + Off)), _mm256_loadu_si256((const __m256i*) (pB + Off)))));
+			if (Diff != 0) {
+				Off += countTrailingZeros(Diff);
+				return ((unsigned char) pA[Off] < (unsigned char) pB[Off]) ? -1 : 1;
+			}
+			if ((Off + 32) >= KL) return 0;
+			Off += 32;
+		}
+	}
+
+	//  mergePfxSSE42
+	//
+	//  SSE4.2 prefix merge kernel, merges blocks of two records from each range with a bitonic merge network
+	//
+	//  PARAMETERS:
+	//
+	//		char*&			-		Reference to the pointer to the next record of the first (target) range
+	//		char*			-		Const pointer to the end of the first range
+	//		char*&			-		Reference to the pointer to the next record of the second (mergee) range
+	//		char*			-		Const pointer to the end of the second range
+	//		char*&			-		Reference to the pointer to the next output record
+	//		size_t			-		Length of a sort record (at most PFXMERGE_MAXRECL)
+	//		size_t			-		Offset of the key prefix in a sort record
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+	//	1.	The two vector form of mergePfxAVX2(), see the notes there.
+	//
+
+	CPUD_TARGET("sse4.2")
+	static void mergePfxSSE42(const char*& pA, const char* pAEnd, const char*& pB, const char* pBEnd, char*& pOut, size_t RecLen, size_t PfxOff) {
+		const size_t	Need = 3 * RecLen;															//  Range remaining for a block
+		__m128i			AK, BK, LoK, HiK, T;														//  Key prefixes
+		__m128i			LoP;																		//  Record pointers of the lower half
+		__m128i			M;																			//  Compare-exchange mask
+		uintptr_t		Src[2] = {};																//  Records to output
+		int				Taken = 0;																	//  Lanes taken from the second range
+		int				LastTaken = -1;																//  Lanes taken by the previous block
+		size_t			Run = 0;																	//  Records taken from one range in succession
+
+		while ((size_t(pAEnd - pA) >= Need) && (size_t(pBEnd - pB) >= Need)) {
+
+			//  Load the prefixes of the next two records of each range, the second range is reversed (bitonic)
+			AK = _mm_set_epi64x(loadPrefix(pA + RecLen + PfxOff), loadPrefix(pA + PfxOff));
+			BK = _mm_set_epi64x(loadPrefix(pB + PfxOff), loadPrefix(pB + RecLen + PfxOff));
+
+			//  Half cleaner, the lower half holds the two lowest prefixes
+			M = _mm_cmpgt_epi64(AK, BK);
+			LoK = _mm_blendv_epi8(AK, BK, M);
+			HiK = _mm_blendv_epi8(BK, AK, M);
+			LoP = _mm_blendv_epi8(_mm_set_epi64x((long long) (pA + RecLen), (long long) pA), _mm_set_epi64x((long long) pB, (long long) (pB + RecLen)), M);
+			Taken = _mm_movemask_pd(_mm_castsi128_pd(M));
+
+			//  Sort the lower half
+			T = _mm_shuffle_epi32(LoK, _MM_SHUFFLE(1, 0, 3, 2));
+			M = _mm_blend_epi16(_mm_cmpgt_epi64(LoK, T), _mm_cmpgt_epi64(T, LoK), 0xF0);
+			LoK = _mm_blendv_epi8(LoK, T, M);
+			LoP = _mm_blendv_epi8(LoP, _mm_shuffle_epi32(LoP, _MM_SHUFFLE(1, 0, 3, 2)), M);
+
+			//  A tie between the lowest three prefixes is decided by the key tails, leave it to the caller
+			T = _mm_unpackhi_epi64(LoK, LoK);
+			if ((_mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(T, LoK))) & 1) == 0) return;
+			if (_mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(HiK, T))) != 3) return;
+
+			//  Output the two lowest records (32 byte copies, a shorter record is rewritten by the next output)
+			_mm_storeu_si128((__m128i*) Src, LoP);
+			for (size_t rIndex = 0; rIndex < 2; rIndex++) {
+				_mm_storeu_si128((__m128i*) pOut, _mm_loadu_si128((const __m128i*) Src[rIndex]));
+				_mm_storeu_si128((__m128i*) (pOut + 16), _mm_loadu_si128((const __m128i*) (Src[rIndex] + 16)));
+				pOut += RecLen;
+			}
+			pB += size_t((Taken & 1) + (Taken >> 1)) * RecLen;
+			pA += size_t(2 - ((Taken & 1) + (Taken >> 1))) * RecLen;
+
+			//  Return to the caller to gallop when one range supplies a run of records
+			if ((Taken != 0) && (Taken != 3)) Run = 0;
+			else if (Taken != LastTaken) Run = 2;
+			else if ((Run += 2) >= PFXMERGE_RUN) return;
+			LastTaken = Taken;
+		}
+
+		//  Return to caller
+		return;
+	}
+
+	//  mergePfxAVX2
+	//
+	//  AVX2 prefix merge kernel, merges blocks of four records from each range with a bitonic merge network
+	//
+	//  PARAMETERS:
+	//
+	//		char*&			-		Reference to the pointer to the next record of the first (target) range
+	//		char*			-		Const pointer to the end of the first range
+	//		char*&			-		Reference to the pointer to the next record of the second (mergee) range
+	//		char*			-		Const pointer to the end of the second range
+	//		char*&			-		Reference to the pointer to the next output record
+	//		size_t			-		Length of a sort record (at most PFXMERGE_MAXRECL)
+	//		size_t			-		Offset of the key prefix in a sort record
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+	//	1.	Both ranges MUST be in ascending key sequence, the range and output pointers are advanced past the merged
+	//		records. The caller completes the merge record by record.
+	//	2.	The next four records of each range are merged by a bitonic network over the key prefixes (the second
+	//		range is loaded in reverse), the record pointers are permuted by the same compare-exchange masks. The four
+	//		lowest records are output and each range is advanced by the number of its records that were output.
+	//	3.	A block is only output when the five lowest prefixes are distinct, the output is then identical to the
+	//		record by record merge whatever the key tails or the tie order. The kernel returns on a prefix tie, when
+	//		either range holds too few records for a block or when one range supplies PFXMERGE_RUN records in
+	//		succession (a run is galloped by the caller).
+	//	4.	Records are copied as 32 bytes, each range MUST hold a record beyond the block so that the copy of a
+	//		shorter record never reads beyond the range. The output ranges of concurrent merges are never overrun.
+	//	5.	The output MUST NOT overlap either range.
+	//
+
+	CPUD_TARGET("avx2")
+	static void mergePfxAVX2(const char*& pA, const char* pAEnd, const char*& pB, const char* pBEnd, char*& pOut, size_t RecLen, size_t PfxOff) {
+		const size_t	Need = 5 * RecLen;															//  Range remaining for a block
+		const __m256i	AOff = _mm256_set_epi64x(3 * RecLen, 2 * RecLen, RecLen, 0);				//  Offsets of the first range records
+		const __m256i	BOff = _mm256_set_epi64x(0, RecLen, 2 * RecLen, 3 * RecLen);				//  Offsets of the second range records
+		static const uint8_t	Counts[16] = { 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 };	//  Lanes set in each mask
+		__m256i			AK, BK, LoK, HiK, T;														//  Key prefixes
+		__m256i			LoP;																		//  Record pointers of the lower half
+		__m256i			M;																			//  Compare-exchange mask
+		uintptr_t		Src[4] = {};																//  Records to output
+		int				Taken = 0;																	//  Lanes taken from the second range
+		int				LastTaken = -1;																//  Lanes taken by the previous block
+		size_t			Run = 0;																	//  Records taken from one range in succession
+
+		while ((size_t(pAEnd - pA) >= Need) && (size_t(pBEnd - pB) >= Need)) {
+
+			//  Load the prefixes of the next four records of each range, the second range is reversed (bitonic)
+			AK = _mm256_set_epi64x(loadPrefix(pA + 3 * RecLen + PfxOff), loadPrefix(pA + 2 * RecLen + PfxOff), loadPrefix(pA + RecLen + PfxOff), loadPrefix(pA + PfxOff));
+			BK = _mm256_set_epi64x(loadPrefix(pB + PfxOff), loadPrefix(pB + RecLen + PfxOff), loadPrefix(pB + 2 * RecLen + PfxOff), loadPrefix(pB + 3 * RecLen + PfxOff));
+
+			//  Half cleaner, the lower half holds the four lowest prefixes
+			M = _mm256_cmpgt_epi64(AK, BK);
+			LoK = _mm256_blendv_epi8(AK, BK, M);
+			HiK = _mm256_blendv_epi8(BK, AK, M);
+			LoP = _mm256_blendv_epi8(_mm256_add_epi64(_mm256_set1_epi64x((long long) pA), AOff), _mm256_add_epi64(_mm256_set1_epi64x((long long) pB), BOff), M);
+			Taken = _mm256_movemask_pd(_mm256_castsi256_pd(M));
+
+			//  Sort the lower half, lanes 0-2 and 1-3 then lanes 0-1 and 2-3
+			T = _mm256_permute4x64_epi64(LoK, _MM_SHUFFLE(1, 0, 3, 2));
+			M = _mm256_blend_epi32(_mm256_cmpgt_epi64(LoK, T), _mm256_cmpgt_epi64(T, LoK), 0xF0);
+			LoK = _mm256_blendv_epi8(LoK, T, M);
+			LoP = _mm256_blendv_epi8(LoP, _mm256_permute4x64_epi64(LoP, _MM_SHUFFLE(1, 0, 3, 2)), M);
+			T = _mm256_permute4x64_epi64(LoK, _MM_SHUFFLE(2, 3, 0, 1));
+			M = _mm256_blend_epi32(_mm256_cmpgt_epi64(LoK, T), _mm256_cmpgt_epi64(T, LoK), 0xCC);
+			LoK = _mm256_blendv_epi8(LoK, T, M);
+			LoP = _mm256_blendv_epi8(LoP, _mm256_permute4x64_epi64(LoP, _MM_SHUFFLE(2, 3, 0, 1)), M);
+
+			//  A tie between the lowest five prefixes is decided by the key tails, leave it to the caller
+			T = _mm256_permute4x64_epi64(LoK, _MM_SHUFFLE(3, 3, 2, 1));
+			if ((_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(T, LoK))) & 7) != 7) return;
+			T = _mm256_permute4x64_epi64(LoK, _MM_SHUFFLE(3, 3, 3, 3));
+			if (_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(HiK, T))) != 15) return;
+
+			//  Output the four lowest records (32 byte copies, a shorter record is rewritten by the next output)
+			_mm256_storeu_si256((__m256i*) Src, LoP);
+			for (size_t rIndex = 0; rIndex < 4; rIndex++) {
+				_mm256_storeu_si256((__m256i*) pOut, _mm256_loadu_si256((const __m256i*) Src[rIndex]));
+				pOut += RecLen;
+			}
+			pB += Counts[Taken] * RecLen;
+			pA += (4 - Counts[Taken]) * RecLen;
+
+			//  Return to the caller to gallop when one range supplies a run of records
+			if ((Taken != 0) && (Taken != 15)) Run = 0;
+			else if (Taken != LastTaken) Run = 4;
+			else if ((Run += 4) >= PFXMERGE_RUN) return;
+			LastTaken = Taken;
+		}
+
+		//  Return to caller
+		return;
+	}
+
+#endif
+
+};
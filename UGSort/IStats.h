@@ -3,7 +3,7 @@
 //*																													*
 //*   File:       IStats.h																							*
 //*   Suite:      Experimental Algorithms																			*
-//*   Version:    1.17.0	(Build: 20)																				*
+//*   Version:    1.36.0	(Build: 40)																				*
 //*   Author:     Ian Tree/HMNL																						*
 //*																													*
 //*   Copyright 2017 - 2026 Ian J. Tree																				*
@@ -22,6 +22,11 @@
 //*	1.15.0 -	10/08/2023	-	Initial Version																		*
 //*	1.16.1 -	19/10/2023	-	Increase PM timer resolution														*
 //*	1.17.0 -	28/01/2026	-	Include instrumentation package														*
+//*	1.26.0 -	16/10/2026	-	Range partitioned parallel sort														*
+//*	1.30.0 -	16/10/2026	-	Size ordered final merge schedule													*
+//*	1.31.0 -	16/10/2026	-	Background preemptive merge															*
+//*	1.32.0 -	16/10/2026	-	Amortised preemptive merge															*
+//*	1.36.0 -	16/10/2026	-	Finger search of the store chain													*
 //*																													*
 //*******************************************************************************************************************/
 
@@ -69,12 +74,19 @@ public:
 		, SortPhase(0)
 		, InputPhase(0)
 		, PMPhase(0)
+		, BGPMPhase(0)
+		, BGStallPhase(0)
 		, FMPhase(0)
 		, OutputPhase(0)
 		, StorePhase(0)
 		, NumPMs(0)
 		, PMStoresMerged(0)
+		, MaxPMPause(0)
 		, FMStoresMerged(0)
+		, FMMoves(0)
+		, FMMovesSaved(0)
+		, FingerProbes(0)
+		, FingerHits(0)
 		, SortRate(0)
 #ifdef INSTRUMENTED
 		, AvailableInstruments(0)
@@ -100,6 +112,8 @@ public:
 		, StartPM(xymorg::CLOCK::now())
 		, EndPM(xymorg::CLOCK::now())
 		, CumPMTime(0)
+		, CumBGPMTime(0)
+		, CumBGStall(0)
 #ifdef INSTRUMENTED
 		, ICNo(0)
 		, Interval(0)
@@ -152,6 +166,8 @@ public:
 	size_t			SortPhase;													//  The complete sort excluding Load & Store data
 	size_t			InputPhase;													//  Sort input phase (excluding PM)
 	size_t			PMPhase;													//  Cumulative Pre-emptive Merge phase
+	size_t			BGPMPhase;													//  Cumulative background PM merging
+	size_t			BGStallPhase;												//  Cumulative insertion stall on background PMs
 	size_t			FMPhase;													//  Final Merge Phase
 	size_t			OutputPhase;												//  Output phase
 	size_t			StorePhase;													//  Store sorted data phase
@@ -159,9 +175,16 @@ public:
 	//  Pre-emptive Merge (PM) statistics
 	size_t			NumPMs;														//  Number of Pre-emptive merges
 	size_t			PMStoresMerged;												//  Number of stores merged by PM
+	size_t			MaxPMPause;													//  Longest insertion pause for a PM (us)
 
 	//  Final Merge (FM) statistics
 	size_t			FMStoresMerged;												//  Number of stores merged by FM
+	size_t			FMMoves;													//  Number of records moved by FM
+	size_t			FMMovesSaved;												//  Record moves saved against alternate merging
+
+	//  Store chain search statistics
+	size_t			FingerProbes;												//  Number of finger searches
+	size_t			FingerHits;													//  Number of keys added to the finger store
 
 	//  Computed Measures
 	size_t			SortRate;													//  Sort rate Keys Per Second (kps)
@@ -233,6 +256,13 @@ public:
 #endif
 		return;
 	}
+	void		recordFMMoves(size_t Moves, size_t AltMoves) {
+		FMMoves += Moves;
+		if (AltMoves > Moves) FMMovesSaved += AltMoves - Moves;
+		return;
+	}
+	void		recordFingerProbe() { FingerProbes++; return; }
+	void		recordFingerHit() { FingerHits++; return; }
 	void		startOutput() { StartOut = xymorg::CLOCK::now(); return; }
 	void		finishOutput() { EndOut = xymorg::CLOCK::now(); return; }
 	void		startStoring() { StartStore = xymorg::CLOCK::now(); return; }
@@ -258,6 +288,47 @@ public:
 		EndPM = xymorg::CLOCK::now();
 		CumPMTime += DURATION(xymorg::MICROSECONDS, EndPM - StartPM);
 		PMStoresMerged += NSM;
+		recordPMPause(DURATION(xymorg::MICROSECONDS, EndPM - StartPM));
+		return;
+	}
+
+	//  recordPMPause() records the time that a single insertion waited for PM work, the longest pause is kept.
+	void		recordPMPause(xymorg::MICROSECONDS Pause) {
+		if (size_t(Pause.count()) > MaxPMPause) MaxPMPause = size_t(Pause.count());
+		return;
+	}
+
+	//  recordPMStep() records a step of an amortised PM made by a single insertion.
+	void		recordPMStep(xymorg::MICROSECONDS Step) {
+		CumPMTime += Step;
+		recordPMPause(Step);
+		return;
+	}
+
+	//  recordBackgroundPM() records a PM that was merged by a background thread, the stall (time that insertion waited
+	//  for the merge to complete) is also counted as PM time.
+	void		recordBackgroundPM(xymorg::MICROSECONDS Merge, xymorg::MICROSECONDS Stall) {
+		CumBGPMTime += Merge;
+		CumBGStall += Stall;
+		CumPMTime += Stall;
+		recordPMPause(Stall);
+		return;
+	}
+
+	//  accumulate() rolls up the counters of a partition sort into this object, the partitions run concurrently so
+	//  the PM time reported is that of the partition that spent longest in PM.
+	void		accumulate(const IStats& Part) {
+		NumKeys += Part.NumKeys;
+		NumPMs += Part.NumPMs;
+		PMStoresMerged += Part.PMStoresMerged;
+		if (Part.MaxPMPause > MaxPMPause) MaxPMPause = Part.MaxPMPause;
+		FMMoves += Part.FMMoves;
+		FMMovesSaved += Part.FMMovesSaved;
+		FingerProbes += Part.FingerProbes;
+		FingerHits += Part.FingerHits;
+		if (Part.CumPMTime > CumPMTime) CumPMTime = Part.CumPMTime;
+		CumBGPMTime += Part.CumBGPMTime;
+		CumBGStall += Part.CumBGStall;
 		return;
 	}
 
@@ -270,6 +341,8 @@ public:
 		PhaseTime = DURATION(xymorg::MILLISECONDS, EndLoad - StartLoad);
 		LoadPhase = size_t(PhaseTime.count());
 		PMPhase = size_t(CumPMTime.count()) / 1000;
+		BGPMPhase = size_t(CumBGPMTime.count()) / 1000;
+		BGStallPhase = size_t(CumBGStall.count()) / 1000;
 		//  Note: Input time is computed as the duration of the phase less the cumulative Pre-emptive Merge duration
 		PhaseTime = DURATION(xymorg::MILLISECONDS, EndInput - StartInput);
 		InputPhase = size_t(PhaseTime.count()) - PMPhase;
@@ -311,13 +384,24 @@ public:
 		//  Report the input phase time
 		Log << "INFO: Sort input phase took: " << InputPhase << " ms (excluding time spent in Pre-emptive Merges)." << std::endl;
 
+		//  If finger search was used then show the hit rate
+		if (FingerProbes > 0) {
+			Log << "INFO: Finger searches: " << FingerProbes << ", hits: " << FingerHits << " (" << ((FingerHits * 100) / FingerProbes) << "%)." << std::endl;
+		}
+
 		//  If there was any PM activity then show it
 		if (NumPMs > 0) {
 			Log << "INFO: Pre-emptive Merges: " << NumPMs << ", merged: " << PMStoresMerged << " stores in: " << PMPhase << " ms." << std::endl;
+			Log << "INFO: Longest insertion pause for a PM: " << MaxPMPause << " us." << std::endl;
+			if (BGPMPhase > 0) {
+				Log << "INFO: Background PM merging took: " << BGPMPhase << " ms, insertion stalled for: " << BGStallPhase << " ms, overlapped: "
+					<< ((BGPMPhase > BGStallPhase) ? (BGPMPhase - BGStallPhase) : 0) << " ms." << std::endl;
+			}
 		}
 
 		//  Show the final merge stats
 		Log << "INFO: Sort final merge phase for: " << FMStoresMerged << " stores took: " << FMPhase << " ms." << std::endl;
+		if (FMMovesSaved > 0) Log << "INFO: Final merge moved: " << FMMoves << " records, saving: " << FMMovesSaved << " moves against alternate merging." << std::endl;
 
 		//  Show the ouput phase
 		Log << "INFO: Sort output phase took: " << OutputPhase << " ms." << std::endl;
@@ -500,6 +584,8 @@ private:
 	xymorg::TIMER			StartPM;											//  Start Pre-emptive Merge
 	xymorg::TIMER			EndPM;												//  End Pre-emptive Merge
 	xymorg::MICROSECONDS	CumPMTime;											//  Cumulative Pre-emptive Merge duration
+	xymorg::MICROSECONDS	CumBGPMTime;										//  Cumulative background PM merge duration
+	xymorg::MICROSECONDS	CumBGStall;											//  Cumulative insertion stall on background PMs
 
 #ifdef INSTRUMENTED
 	int						ICNo;												//  Instrument Cycle Number
@@ -0,0 +1,435 @@
+#pragma once
+//*******************************************************************************************************************
+//*																													*
+//*   File:       KeyCompare.h																						*
+//*   Suite:      Experimental Algorithms																			*
+//*   Version:    1.41.0	(Build: 45)																				*
+//*   Author:     Ian Tree/HMNL																						*
+//*																													*
+//*   Copyright 2017 - 2026 Ian J. Tree																				*
+//*******************************************************************************************************************
+//*																													*
+//*	This header file contains the key comparison functions for internal sort records.								*
+//* Internal sort record types MUST contain either a member 'pKey' that is a pointer to the sort key or a member	*
+//* function 'key()' that locates the sort key (compact index records). A record type MAY							*
+//* also contain a member 'KeyPfx' (uint64_t) that holds the first 8 bytes of the key in big-endian order. When		*
+//* present the comparison is decided on the prefix, the key is only dereferenced when the prefixes are equal.		*
+//* The comparison of the key bytes is made by a comparator policy. VarKeyCompare compares keys of any length with	*
+//* the kernel for the selected kernel level (vector equality masks, memcmp() at the scalar level),					*
+//* FixedKeyCompare<N> compares keys of exactly N bytes with fixed width (byte swapped) loads.						*
+//*																													*
+//*	NOTES:																											*
+//*																													*
+//*	1.	The prefix of keys shorter than 8 bytes is zero padded, the ordering is identical to memcmp() on the key.	*
+//*	2.	Selection of the prefix or plain comparison is made at compile time from the record type.					*
+//*	3.	FixedKeyCompare<N> ignores the run time key length, it MUST only be used when the key length is N.			*
+//*	4.	Keys of record types without a 'pKey' member cannot be relocated (setKey() has no effect), these types		*
+//*		MUST NOT be used with a KeyStore.																			*
+//*	5.	Every kernel orders keys exactly as memcmp() does (unsigned bytes).											*
+//*																													*
+//*******************************************************************************************************************
+//*																													*
+//*   History:																										*
+//*																													*
+//*	1.22.0 -	16/10/2026	-	Initial Release																		*
+//*	1.23.0 -	16/10/2026	-	Comparator policies																	*
+//*	1.24.0 -	16/10/2026	-	Boundary key index for the binary chop												*
+//*	1.37.0 -	16/10/2026	-	Compact sort record formats															*
+//*	1.39.0 -	16/10/2026	-	Branchless merge kernel																*
+//*	1.41.0 -	16/10/2026	-	Vector key compare kernels															*
+//*																													*
+//*******************************************************************************************************************/
+
+//  Include xymorg headers
+#include	"../xymorg/xymorg.h"															//  xymorg system headers
+
+//  Application headers
+#include	"CPUDispatch.h"																				//  Processor feature dispatch
+
+//  loadKeyWord
+//
+//  Returns W (1, 2, 4 or 8) bytes of a key as a big-endian (memcmp ordered) unsigned integer
+//
+//  PARAMETERS:
+//
+//		char*			-		Const pointer to the first byte to load
+//		size_t			-		Width of the load (bytes)
+//
+//  RETURNS:
+//
+//		uint64_t		-		The loaded bytes
+//
+//  NOTES:
+//
+//	1.	The width is a compile time constant at every call site so the switch is resolved by the compiler.
+//
+
+inline uint64_t	loadKeyWord(const char* pKey, size_t W) {
+	uint64_t		W64 = 0;																	//  8 byte word
+	uint32_t		W32 = 0;																	//  4 byte word
+	uint16_t		W16 = 0;																	//  2 byte word
+
+	switch (W) {
+	case 8:
+		memcpy(&W64, pKey, 8);
+#if (defined(_MSC_VER))
+		return _byteswap_uint64(W64);
+#elif (defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__))
+		return W64;
+#else
+		return __builtin_bswap64(W64);
+#endif
+
+	case 4:
+		memcpy(&W32, pKey, 4);
+#if (defined(_MSC_VER))
+		return _byteswap_ulong(W32);
+#elif (defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__))
+		return W32;
+#else
+		return __builtin_bswap32(W32);
+#endif
+
+	case 2:
+		memcpy(&W16, pKey, 2);
+#if (defined(_MSC_VER))
+		return _byteswap_ushort(W16);
+#elif (defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__))
+		return W16;
+#else
+		return __builtin_bswap16(W16);
+#endif
+
+	default:
+		return uint64_t((unsigned char)pKey[0]);
+	}
+}
+
+//  loadKeyPrefix
+//
+//  Returns the first 8 bytes of the passed key as a big-endian (memcmp ordered) unsigned integer
+//
+//  PARAMETERS:
+//
+//		char*			-		Const pointer to the key
+//		size_t			-		Sort Key Length
+//
+//  RETURNS:
+//
+//		uint64_t		-		The key prefix
+//
+//  NOTES:
+//
+
+inline uint64_t	loadKeyPrefix(const char* pKey, size_t KL) {
+	uint64_t		Prefix = 0;																	//  Key prefix
+	size_t			PL = (KL < 8) ? KL : 8;														//  Prefix length
+
+	if (PL == 8) return loadKeyWord(pKey, 8);
+	for (size_t bIndex = 0; bIndex < PL; bIndex++) Prefix = (Prefix << 8) | uint64_t((unsigned char)pKey[bIndex]);
+	return Prefix << (8 * (8 - PL));
+}
+
+//  compareKeyBytes
+//
+//  Compares two keys of any length with the kernel for the selected kernel level
+//
+//  PARAMETERS:
+//
+//		char*			-		Const pointer to the first key
+//		char*			-		Const pointer to the second key
+//		size_t			-		Length of the keys
+//
+//  RETURNS:
+//
+//		int				-		<0, 0 or >0 as the first key is below, equal to or above the second key (memcmp semantics)
+//
+//  NOTES:
+//
+//	1.	The first 8 bytes are compared as a single big-endian word, this decides most comparisons of unrelated keys
+//		without a call. Keys of 24 bytes or more continue with the key compare kernel selected by
+//		CPUDispatch::select() (memcmp() at the scalar level) and keys of 9 to 23 bytes with the (overlapping) last word.
+//
+
+inline int	compareKeyBytes(const char* pA, const char* pB, size_t KL) {
+	uint64_t		A = 0;																		//  Word from the first key
+	uint64_t		B = 0;																		//  Word from the second key
+
+	if (KL < 8) return memcmp(pA, pB, KL);
+
+	//  Leading word
+	A = loadKeyWord(pA, 8);
+	B = loadKeyWord(pB, 8);
+	if (A != B) return (A < B) ? -1 : 1;
+	if (KL >= 24) return CPUDispatch::compareKeyBlocks(pA + 8, pB + 8, KL - 8);
+	if (KL == 8) return 0;
+
+	//  Middle word of a 17 to 23 byte key
+	if (KL > 16) {
+		A = loadKeyWord(pA + 8, 8);
+		B = loadKeyWord(pB + 8, 8);
+		if (A != B) return (A < B) ? -1 : 1;
+	}
+
+	//  Trailing (overlapping) word
+	A = loadKeyWord(pA + (KL - 8), 8);
+	B = loadKeyWord(pB + (KL - 8), 8);
+	if (A != B) return (A < B) ? -1 : 1;
+	return 0;
+}
+
+//
+//  FixedKeyBytes Template - compares exactly Len bytes using the widest loads available
+//
+
+template <size_t Len>
+struct FixedKeyBytes {
+	static const size_t W = (Len >= 8) ? 8 : ((Len >= 4) ? 4 : ((Len >= 2) ? 2 : 1));			//  Width of the next load
+
+	static int	compare(const char* pA, const char* pB) {
+		uint64_t		A = loadKeyWord(pA, W);														//  Word from the first key
+		uint64_t		B = loadKeyWord(pB, W);														//  Word from the second key
+
+		if (A != B) return (A < B) ? -1 : 1;
+		return FixedKeyBytes<Len - W>::compare(pA + W, pB + W);
+	}
+};
+
+template <>
+struct FixedKeyBytes<0> {
+	static int	compare(const char*, const char*) { return 0; }
+};
+
+//
+//  VarKeyCompare - Comparator policy for keys of any length
+//
+
+struct VarKeyCompare {
+
+	//  Compare the whole key
+	static int	compare(const char* pA, const char* pB, size_t KL) { return compareKeyBytes(pA, pB, KL); }
+
+	//  Compare the key following the 8 byte prefix
+	static int	compareTail(const char* pA, const char* pB, size_t KL) {
+		if (KL <= 8) return 0;
+		return compareKeyBytes(pA + 8, pB + 8, KL - 8);
+	}
+};
+
+//
+//  FixedKeyCompare - Comparator policy for keys of exactly N bytes
+//
+
+template <size_t N>
+struct FixedKeyCompare {
+
+	//  Compare the whole key
+	static int	compare(const char* pA, const char* pB, size_t) { return FixedKeyBytes<N>::compare(pA, pB); }
+
+	//  Compare the key following the 8 byte prefix
+	static int	compareTail(const char* pA, const char* pB, size_t) { return FixedKeyBytes<(N > 8) ? N - 8 : 0>::compare(pA + 8, pB + 8); }
+};
+
+//  getKey
+//
+//  Returns a pointer to the sort key of a sort record
+//
+//  PARAMETERS:
+//
+//		T&				-		Const reference to the sort record
+//
+//  RETURNS:
+//
+//		char*			-		Const pointer to the sort key
+//
+//  NOTES:
+//
+//	1.	The 'pKey' member is used if the record type holds one, otherwise the key() member function locates the key.
+//
+
+template <typename T>
+inline auto	getKey(const T& Rec, int) -> decltype(Rec.pKey, (const char*) nullptr) { return Rec.pKey; }
+
+template <typename T>
+inline const char*	getKey(const T& Rec, long) { return Rec.key(); }
+
+template <typename T>
+inline const char*	getKey(const T& Rec) { return getKey(Rec, 0); }
+
+//  setKey
+//
+//  Points a sort record at a (relocated) copy of its sort key
+//
+//  PARAMETERS:
+//
+//		T&				-		Reference to the sort record
+//		char*			-		Const pointer to the sort key
+//
+//  RETURNS:
+//
+//  NOTES:
+//
+//	1.	Has no effect for record types that do not hold a 'pKey' member.
+//
+
+template <typename T>
+inline auto	setKey(T& Rec, const char* pKey, int) -> decltype(Rec.pKey, void()) {
+	Rec.pKey = pKey;
+	return;
+}
+
+template <typename T>
+inline void	setKey(T&, const char*, long) { return; }
+
+template <typename T>
+inline void	setKey(T& Rec, const char* pKey) { setKey(Rec, pKey, 0); return; }
+
+//  setKeyPrefix
+//
+//  Sets the key prefix in a sort record from the key that the record points to
+//
+//  PARAMETERS:
+//
+//		T&				-		Reference to the sort record
+//		size_t			-		Sort Key Length
+//
+//  RETURNS:
+//
+//  NOTES:
+//
+//	1.	Has no effect for record types that do not hold a key prefix.
+//
+
+template <typename T>
+inline auto	setKeyPrefix(T& Rec, size_t KL, int) -> decltype(Rec.KeyPfx, void()) {
+	Rec.KeyPfx = loadKeyPrefix(getKey(Rec), KL);
+	return;
+}
+
+template <typename T>
+inline void	setKeyPrefix(T&, size_t, long) { return; }
+
+template <typename T>
+inline void	setKeyPrefix(T& Rec, size_t KL) { setKeyPrefix(Rec, KL, 0); return; }
+
+//  getKeyPrefix
+//
+//  Returns the key prefix of a sort record
+//
+//  PARAMETERS:
+//
+//		T&				-		Const reference to the sort record
+//		size_t			-		Sort Key Length
+//
+//  RETURNS:
+//
+//		uint64_t		-		The key prefix
+//
+//  NOTES:
+//
+//	1.	The prefix held in the record is used if the record type holds one, otherwise it is loaded from the key.
+//
+
+template <typename T>
+inline auto	getKeyPrefix(const T& Rec, size_t, int) -> decltype(Rec.KeyPfx, uint64_t()) { return Rec.KeyPfx; }
+
+template <typename T>
+inline uint64_t	getKeyPrefix(const T& Rec, size_t KL, long) { return loadKeyPrefix(getKey(Rec), KL); }
+
+template <typename T>
+inline uint64_t	getKeyPrefix(const T& Rec, size_t KL) { return getKeyPrefix(Rec, KL, 0); }
+
+//  getPrefixMerger
+//
+//  Returns the vector merge kernel for a sort record type
+//
+//  PARAMETERS:
+//
+//		size_t&			-		Reference to the offset of the key prefix in the record (set when a kernel is returned)
+//
+//  RETURNS:
+//
+//		PfxMerger		-		The prefix merge kernel, nullptr if the records are merged record by record
+//
+//  NOTES:
+//
+//	1.	Only record types holding a key prefix and no longer than PFXMERGE_MAXRECL have a kernel, and then only
+//		when a kernel is selected for the kernel level.
+//
+
+template <typename T>
+inline auto	getPrefixMerger(size_t& PfxOff, const T* pRec, int) -> decltype(pRec->KeyPfx, CPUDispatch::PfxMerger()) {
+	if (sizeof(T) > PFXMERGE_MAXRECL) return nullptr;
+	PfxOff = offsetof(T, KeyPfx);
+	return CPUDispatch::getPrefixMerger();
+}
+
+template <typename T>
+inline CPUDispatch::PfxMerger	getPrefixMerger(size_t&, const T*, long) { return nullptr; }
+
+template <typename T>
+inline CPUDispatch::PfxMerger	getPrefixMerger(size_t& PfxOff) { return getPrefixMerger(PfxOff, (const T*) nullptr, 0); }
+
+//  compareKeys
+//
+//  Compares the keys of two sort records using the comparator policy C
+//
+//  PARAMETERS:
+//
+//		T&				-		Const reference to the first sort record
+//		T&				-		Const reference to the second sort record
+//		size_t			-		Sort Key Length
+//
+//  RETURNS:
+//
+//		int				-		<0, 0 or >0 as the first key is below, equal to or above the second key (memcmp semantics)
+//
+//  NOTES:
+//
+
+template <typename C, typename T>
+inline auto	compareKeys(const T& A, const T& B, size_t KL, int) -> decltype(A.KeyPfx, int()) {
+	if (A.KeyPfx != B.KeyPfx) return (A.KeyPfx < B.KeyPfx) ? -1 : 1;
+	return C::compareTail(getKey(A), getKey(B), KL);
+}
+
+template <typename C, typename T>
+inline int	compareKeys(const T& A, const T& B, size_t KL, long) { return C::compare(getKey(A), getKey(B), KL); }
+
+template <typename C, typename T>
+inline int	compareKeys(const T& A, const T& B, size_t KL) { return compareKeys<C>(A, B, KL, 0); }
+
+//  keyPrecedes
+//
+//  Determines if the first sort record is placed ahead of the second in a merge
+//
+//  PARAMETERS:
+//
+//		T&				-		Const reference to the first sort record
+//		T&				-		Const reference to the second sort record
+//		size_t			-		Sort Key Length
+//		int				-		Highest compare result that places the first record ahead (0 or -1)
+//
+//  RETURNS:
+//
+//		bool			-		true if the first record is placed ahead of the second, otherwise false
+//
+//  NOTES:
+//
+//	1.	For record types holding a key prefix the result is formed from the prefixes, the key tails are only compared
+//		(a rarely taken branch on unrelated keys) when the prefixes are equal.
+//
+
+template <typename C, typename T>
+inline auto	keyPrecedes(const T& A, const T& B, size_t KL, int TieLimit, int) -> decltype(A.KeyPfx, bool()) {
+	bool			Precedes = A.KeyPfx < B.KeyPfx;												//  Result from the prefixes
+
+	if (A.KeyPfx == B.KeyPfx) Precedes = C::compareTail(getKey(A), getKey(B), KL) <= TieLimit;
+	return Precedes;
+}
+
+template <typename C, typename T>
+inline bool	keyPrecedes(const T& A, const T& B, size_t KL, int TieLimit, long) { return C::compare(getKey(A), getKey(B), KL) <= TieLimit; }
+
+template <typename C, typename T>
+inline bool	keyPrecedes(const T& A, const T& B, size_t KL, int TieLimit) { return keyPrecedes<C>(A, B, KL, TieLimit, 0); }
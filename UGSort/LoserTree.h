@@ -0,0 +1,282 @@
+#pragma once
+//*******************************************************************************************************************
+//*																													*
+//*   File:       LoserTree.h																						*
+//*   Suite:      Experimental Algorithms																			*
+//*   Version:    1.35.0	(Build: 39)																				*
+//*   Author:     Ian Tree/HMNL																						*
+//*																													*
+//*   Copyright 2017 - 2026 Ian J. Tree																				*
+//*******************************************************************************************************************
+//*																													*
+//*	This header file contains the definition for the LoserTree template class.										*
+//* The LoserTree class provides a k-way merge over the sorted record arrays of a chain of SplitStores. Records		*
+//* are delivered one at a time in the requested sequence, so the final merge can be streamed directly into the		*
+//* sort output phase without materialising a single merged array.													*
+//*																													*
+//*	ALGORITHM:																										*
+//*																													*
+//*	A tournament tree of k leaves (one per store) holds the loser of each match in the internal nodes and the		*
+//* overall winner at the root. Delivering a record replaces the winning leaf with its successor and replays only	*
+//* the matches on the path from that leaf to the root, log2(k) comparisons per record.								*
+//*																													*
+//*	NOTES:																											*
+//*																													*
+//*	1.	Identical keys are always won by the leaf with the lower store index. For stable sorts this preserves the	*
+//*		input sequence, the earlier records of a set of identical keys are always held in the shallower stores.		*
+//*	2.	For descending sequences each store is consumed from the high end to the low end.							*
+//*																													*
+//*******************************************************************************************************************
+//*																													*
+//*   History:																										*
+//*																													*
+//*	1.20.0 -	16/10/2026	-	Initial Release																		*
+//*	1.22.0 -	16/10/2026	-	Inline key prefix in sort records													*
+//*	1.23.0 -	16/10/2026	-	Comparator policy template parameter												*
+//*	1.29.0 -	16/10/2026	-	Single pass k-way tail suppression													*
+//*	1.35.0 -	16/10/2026	-	Segmented double ended SRA storage													*
+//*																													*
+//*******************************************************************************************************************/
+
+//  Include xymorg headers
+#include	"../xymorg/xymorg.h"															//  xymorg system headers
+
+//  Application Headers
+#include	"KeyCompare.h"																	//  Sort key comparison
+
+//  Forward declaration of the SplitStore class template (the merged stores)
+template <typename T, typename C> class SplitStore;
+
+//
+//  LoserTree Class Template
+//
+
+template <typename T, typename C = VarKeyCompare>
+class LoserTree {
+public:
+
+	//*******************************************************************************************************************
+	//*                                                                                                                 *
+	//*   Constructors			                                                                                        *
+	//*                                                                                                                 *
+	//*******************************************************************************************************************
+
+	//  Constructor
+	//
+	//  Constructs the LoserTree over the passed array of stores and plays the initial tournament
+	//
+	//  PARAMETERS:
+	//
+	//		SplitStore**	-		Pointer to the array of stores to be merged
+	//		size_t			-		Number of stores in the array
+	//		size_t			-		Sort Key Length
+	//		bool			-		true if the sequence is ascending, false if descending
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+	//	1.	The records of every store MUST be contiguous in its SRA (see SplitStore::flatten()).
+	//
+
+	LoserTree(SplitStore<T, C>** pStores, size_t Stores, size_t KeyLen, bool Ascending) : K(Stores), KL(KeyLen), Asc(Ascending) {
+
+		//  Allocate the leaf cursors and the tree nodes
+		pNext = (T**)malloc(K * sizeof(T*));
+		pLeft = (size_t*)malloc(K * sizeof(size_t));
+		pLoser = (size_t*)malloc(K * sizeof(size_t));
+		if ((pNext == nullptr) || (pLeft == nullptr) || (pLoser == nullptr)) {
+			//  Fatal
+			std::cerr << "FATAL: Failed to allocate a loser tree for: " << K << " stores." << std::endl;
+			std::abort();
+		}
+
+		//  Position the cursor for each leaf at the first record to be delivered from the store
+		for (size_t lIndex = 0; lIndex < K; lIndex++) {
+			SplitStore<T, C>* pSS = pStores[lIndex];
+			if (Asc) pNext[lIndex] = &pSS->pSRA[pSS->SRALo];
+			else pNext[lIndex] = &pSS->pSRA[pSS->SRAHi];
+			pLeft[lIndex] = pSS->SRANum;
+		}
+
+		//  Play the initial tournament, every node starts holding the virtual leaf K that beats all others
+		for (size_t nIndex = 0; nIndex < K; nIndex++) pLoser[nIndex] = K;
+		for (size_t lIndex = K; lIndex > 0; lIndex--) replay(lIndex - 1);
+
+		//  Return to caller
+		return;
+	}
+
+	//*******************************************************************************************************************
+	//*                                                                                                                 *
+	//*   Destructor			                                                                                        *
+	//*                                                                                                                 *
+	//*******************************************************************************************************************
+
+	//  Destructor
+	//
+	//  Destroys the LoserTree, the stores that were merged are NOT affected
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+
+	~LoserTree() {
+
+		if (pNext != nullptr) free(pNext);
+		if (pLeft != nullptr) free(pLeft);
+		if (pLoser != nullptr) free(pLoser);
+		pNext = nullptr;
+		pLeft = pLoser = nullptr;
+
+		//  Return to caller
+		return;
+	}
+
+	//*******************************************************************************************************************
+	//*                                                                                                                 *
+	//*   Public Functions                                                                                              *
+	//*                                                                                                                 *
+	//*******************************************************************************************************************
+
+	//  next
+	//
+	//  Returns the next record in the merged sequence
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//		T*			-		Pointer to the next record, nullptr when all stores are exhausted
+	//
+	//  NOTES:
+	//
+
+	T* next() {
+		size_t			Winner = pLoser[0];															//  Winning leaf
+		T* pRec = nullptr;																			//  Record to deliver
+
+		//  All leaves exhausted
+		if (K == 0 || isExhausted(Winner)) return nullptr;
+
+		//  Take the record from the winning leaf and advance the leaf
+		pRec = pNext[Winner];
+		pLeft[Winner]--;
+		if (pLeft[Winner] > 0) {
+			if (Asc) pNext[Winner]++;
+			else pNext[Winner]--;
+		}
+
+		//  Replay the matches on the path from the winning leaf
+		replay(Winner);
+
+		//  Return the record
+		return pRec;
+	}
+
+private:
+
+	//*******************************************************************************************************************
+	//*                                                                                                                 *
+	//*   Private Members			                                                                                    *
+	//*                                                                                                                 *
+	//*******************************************************************************************************************
+
+	size_t			K;																		//  Number of leaves (stores)
+	size_t			KL;																		//  Key Length
+	bool			Asc;																	//  Ascending sequence
+	T**				pNext;																	//  Next record for each leaf
+	size_t*			pLeft;																	//  Records remaining for each leaf
+	size_t*			pLoser;																	//  Losers at each node, [0] is the winner
+
+	//*******************************************************************************************************************
+	//*                                                                                                                 *
+	//*   Private Functions                                                                                             *
+	//*                                                                                                                 *
+	//*******************************************************************************************************************
+
+	//  isExhausted
+	//
+	//  Determines if a leaf has no more records to deliver
+	//
+	//  PARAMETERS:
+	//
+	//		size_t			-		Leaf index
+	//
+	//  RETURNS:
+	//
+	//		bool			-		true if the leaf is exhausted, otherwise false
+	//
+	//  NOTES:
+	//
+
+	bool	isExhausted(size_t Leaf) const { return pLeft[Leaf] == 0; }
+
+	//  beats
+	//
+	//  Determines if the first leaf wins a match against the second leaf
+	//
+	//  PARAMETERS:
+	//
+	//		size_t			-		First leaf index
+	//		size_t			-		Second leaf index
+	//
+	//  RETURNS:
+	//
+	//		bool			-		true if the first leaf wins, otherwise false
+	//
+	//  NOTES:
+	//
+	//	1.	The virtual leaf K beats every leaf, an exhausted leaf loses to every leaf.
+	//
+
+	bool	beats(size_t First, size_t Second) const {
+		int			Cmp = 0;																//  Key comparison
+
+		if (First == K) return true;
+		if (Second == K) return false;
+		if (isExhausted(First)) return false;
+		if (isExhausted(Second)) return true;
+
+		Cmp = compareKeys<C>(*pNext[First], *pNext[Second], KL);
+		if (Cmp == 0) return First < Second;
+		if (Asc) return Cmp < 0;
+		return Cmp > 0;
+	}
+
+	//  replay
+	//
+	//  Replays the matches on the path from the passed leaf to the root of the tree
+	//
+	//  PARAMETERS:
+	//
+	//		size_t			-		Leaf index
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+
+	void	replay(size_t Leaf) {
+		size_t			Winner = Leaf;																//  Current winner
+		size_t			Node = (Leaf + K) / 2;														//  Node on the path to the root
+		size_t			Temp = 0;
+
+		while (Node > 0) {
+			if (beats(pLoser[Node], Winner)) {
+				Temp = pLoser[Node];
+				pLoser[Node] = Winner;
+				Winner = Temp;
+			}
+			Node = Node / 2;
+		}
+		pLoser[0] = Winner;
+
+		//  Return to caller
+		return;
+	}
+
+};
@@ -0,0 +1,262 @@
+//*******************************************************************************************************************
+//*																													*
+//*   File:       MergeBench.cpp																					*
+//*   Suite:      Experimental Algorithms																			*
+//*   Version:    1.42.0	(Build: 46)																				*
+//*   Author:     Ian Tree/HMNL																						*
+//*																													*
+//*   Copyright 2017 - 2026 Ian J. Tree																				*
+//*******************************************************************************************************************
+//*	MergeBench																										*
+//*																													*
+//*	This application is the microbenchmark for the two way store merge kernels. Two sorted runs of sort records		*
+//*	holding an inline key prefix are merged by SplitStore::mergeNextStore() at each kernel level supported by the	*
+//*	processor, the scalar level is the record by record merge. The merged output of every level is checked			*
+//*	against the output of the scalar level.																			*
+//*																													*
+//*	USAGE:																											*
+//*																													*
+//*		MergeBench [records [repetitions [key length [keys]]]]														*
+//*																													*
+//*		records		-	Records in each run (default 65536)															*
+//*		repetitions	-	Merges timed at each level (default 200)													*
+//*		key length	-	Length of the sort keys (default 20)														*
+//*		keys		-	random (default), dups (256 distinct keys) or prefix (identical first 8 bytes)				*
+//*																													*
+//*	NOTES:																											*
+//*																													*
+//*	1.	The runs are flattened before each merge so that only the merge is timed.									*
+//*																													*
+//*******************************************************************************************************************
+//*																													*
+//*   History:																										*
+//*																													*
+//*	1.42.0 -	17/10/2026	-	Initial Release																		*
+//*																													*
+//*******************************************************************************************************************/
+
+//  Include xymorg headers
+#include	"../xymorg/xymorg.h"															//  xymorg system headers
+
+//  Standard Library Headers
+#include	<random>																		//  Key generation
+#include	<algorithm>																		//  Run sorting
+#include	<iomanip>																		//  Report formatting
+
+//  Application Headers
+#include	"IStats.h"																		//  Instrumentation
+#include	"CPUDispatch.h"																	//  Processor feature dispatch
+#include	"SplitStore.h"																	//  SplitStore template class
+
+//  Sort Record for In-Memory sorting with an inline key prefix (as Sorter::IMSRP)
+typedef struct BenchRec {
+	const char*		pKey;													//  Pointer tho the Sort Key
+	const char*		pRec;													//  Pointer to the in-memory record
+	uint64_t		KeyPfx;													//  First 8 bytes of the key (big-endian)
+} BenchRec;
+
+//  Forward Declarations/ Function Prototypes
+bool		buildRun(BenchRec* pRun, size_t Records, char* pKeys, size_t KL, const char* pMode, unsigned int Seed);	//  Build a sorted run
+bool		mergeRuns(const BenchRec* pRunA, const BenchRec* pRunB, size_t Records, size_t KL, bool MergeeFirst, BenchRec* pOut, double& Millis);	//  Merge two runs
+
+//  Main Entry Point for the MergeBench application
+
+int main(int argc, char* argv[])
+{
+	size_t			Records = (argc > 1) ? size_t(atol(argv[1])) : 65536;						//  Records in each run
+	size_t			Reps = (argc > 2) ? size_t(atol(argv[2])) : 200;							//  Merges timed at each level
+	size_t			KL = (argc > 3) ? size_t(atol(argv[3])) : 20;								//  Sort key length
+	const char*		pMode = (argc > 4) ? argv[4] : "random";									//  Key distribution
+	char*			pKeys = nullptr;															//  Keys of both runs
+	BenchRec*		pRunA = nullptr;															//  First (target) run
+	BenchRec*		pRunB = nullptr;															//  Second (mergee) run
+	BenchRec*		pRef = nullptr;																//  Reference outputs (scalar level, both tie orders)
+	BenchRec*		pOut = nullptr;																//  Output of the level
+	double			Millis = 0.0;																//  Time for one merge
+	double			PerMerge = 0.0;																//  Mean time per merge
+	double			Base = 0.0;																	//  Mean time per merge at the scalar level
+	bool			Valid = true;																//  All outputs match the reference
+
+	if ((Records < 2) || (Reps < 1) || (KL < 1)) {
+		std::cerr << "ERROR: Usage: MergeBench [records [repetitions [key length [random|dups|prefix]]]]." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	//  Build the two runs
+	pKeys = (char*) malloc(2 * Records * KL);
+	pRunA = (BenchRec*) malloc(Records * sizeof(BenchRec));
+	pRunB = (BenchRec*) malloc(Records * sizeof(BenchRec));
+	pRef = (BenchRec*) malloc(4 * Records * sizeof(BenchRec));
+	pOut = (BenchRec*) malloc(2 * Records * sizeof(BenchRec));
+	if ((pKeys == nullptr) || (pRunA == nullptr) || (pRunB == nullptr) || (pRef == nullptr) || (pOut == nullptr)) {
+		std::cerr << "ERROR: Unable to allocate the runs for: " << Records << " records." << std::endl;
+		return EXIT_FAILURE;
+	}
+	if (!buildRun(pRunA, Records, pKeys, KL, pMode, 1) || !buildRun(pRunB, Records, pKeys + (Records * KL), KL, pMode, 2)) {
+		std::cerr << "ERROR: Unknown key distribution: " << pMode << "." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	std::cout << "MergeBench: " << Records << " + " << Records << " records, " << KL << " byte " << pMode << " keys, "
+		<< Reps << " merges per level, cpu: " << CPUDispatch::getFeatures() << "." << std::endl;
+
+	//  The record by record merge (scalar level) provides the reference output for both tie orders
+	CPUDispatch::select(ISA_SCALAR);
+	if (!mergeRuns(pRunA, pRunB, Records, KL, false, pRef, Millis)) return EXIT_FAILURE;
+	if (!mergeRuns(pRunA, pRunB, Records, KL, true, pRef + (2 * Records), Millis)) return EXIT_FAILURE;
+
+	//  Check and time the merge at each kernel level (the AVX-512 level uses the AVX2 kernel)
+	for (int Level = ISA_SCALAR; (Level <= ISA_AVX2) && (Level <= CPUDispatch::getDetected()); Level++) {
+		CPUDispatch::select(Level);
+
+		for (int Order = 0; Order < 2; Order++) {
+			if (!mergeRuns(pRunA, pRunB, Records, KL, Order == 1, pOut, Millis)) return EXIT_FAILURE;
+			if (memcmp(pOut, pRef + (Order * 2 * Records), 2 * Records * sizeof(BenchRec)) != 0) {
+				std::cerr << "ERROR: The " << CPUDispatch::getLevelName(Level) << " merge output (" << (Order == 1 ? "mergee" : "target")
+					<< " first on ties) does not match the record by record merge." << std::endl;
+				Valid = false;
+			}
+		}
+
+		PerMerge = 0.0;
+		for (size_t rIndex = 0; rIndex < Reps; rIndex++) {
+			if (!mergeRuns(pRunA, pRunB, Records, KL, false, pOut, Millis)) return EXIT_FAILURE;
+			PerMerge += Millis;
+		}
+		PerMerge = PerMerge / double(Reps);
+		if (Level == ISA_SCALAR) Base = PerMerge;
+
+		std::cout << "  " << std::left << std::setw(8) << CPUDispatch::getLevelName(Level) << std::right << std::fixed
+			<< std::setprecision(3) << std::setw(9) << PerMerge << " ms per merge, " << std::setprecision(1) << std::setw(7)
+			<< double(2 * Records) / (PerMerge * 1000.0) << " M records/s, x" << std::setprecision(2) << Base / PerMerge << std::endl;
+	}
+
+	//  Free the runs
+	free(pKeys);
+	free(pRunA);
+	free(pRunB);
+	free(pRef);
+	free(pOut);
+
+	return Valid ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+//  buildRun
+//
+//  This function builds a run of sort records in ascending key sequence
+//
+//  PARAMETERS:
+//
+//		BenchRec*		-		Pointer to the array of sort records to build
+//		size_t			-		Number of records in the run
+//		char*			-		Pointer to the buffer for the keys of the run
+//		size_t			-		Sort key length
+//		char*			-		Const pointer to the key distribution name
+//		unsigned int	-		Seed for the key generator
+//
+//  RETURNS:
+//
+//		bool			-		true if the run was built, false if the distribution is unknown
+//
+//  NOTES:
+//
+//	1.	Each record points at its own key so that the output of two merges is identical only when the records are
+//		in the same sequence, records with identical keys stay in generation sequence.
+//
+
+bool	buildRun(BenchRec* pRun, size_t Records, char* pKeys, size_t KL, const char* pMode, unsigned int Seed) {
+	const char		Alphabet[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";	//  Key characters
+	std::mt19937	Gen(Seed);																	//  Key generator
+	std::mt19937	Dups(7);																	//  Generator of the distinct keys (both runs)
+	std::vector<std::string>	Distinct;														//  Distinct keys (dups)
+	std::vector<size_t>			Order(Records);													//  Records in key sequence
+	size_t			Fixed = 0;																	//  Leading key bytes shared by every key
+
+	if (strcmp(pMode, "dups") == 0) {
+		for (size_t kIndex = 0; kIndex < 256; kIndex++) {
+			Distinct.push_back(std::string());
+			for (size_t bIndex = 0; bIndex < KL; bIndex++) Distinct.back() += Alphabet[Dups() % 62];
+		}
+	}
+	else if (strcmp(pMode, "prefix") == 0) Fixed = (KL < 8) ? KL : 8;
+	else if (strcmp(pMode, "random") != 0) return false;
+
+	//  Generate the keys
+	for (size_t rIndex = 0; rIndex < Records; rIndex++) {
+		char*		pKey = pKeys + (rIndex * KL);												//  Key of the record
+
+		if (!Distinct.empty()) memcpy(pKey, Distinct[Gen() % Distinct.size()].c_str(), KL);
+		else {
+			for (size_t bIndex = 0; bIndex < KL; bIndex++) pKey[bIndex] = (bIndex < Fixed) ? 'P' : Alphabet[Gen() % 62];
+		}
+		Order[rIndex] = rIndex;
+	}
+
+	//  Place the records in key sequence
+	std::stable_sort(Order.begin(), Order.end(), [pKeys, KL](size_t A, size_t B) { return memcmp(pKeys + (A * KL), pKeys + (B * KL), KL) < 0; });
+	for (size_t rIndex = 0; rIndex < Records; rIndex++) {
+		pRun[rIndex].pKey = pKeys + (Order[rIndex] * KL);
+		pRun[rIndex].pRec = pRun[rIndex].pKey;
+		setKeyPrefix(pRun[rIndex], KL);
+	}
+
+	//  Return showing success
+	return true;
+}
+
+//  mergeRuns
+//
+//  This function merges two runs of sort records with SplitStore::mergeNextStore()
+//
+//  PARAMETERS:
+//
+//		BenchRec*		-		Const pointer to the first (target) run
+//		BenchRec*		-		Const pointer to the second (mergee) run
+//		size_t			-		Number of records in each run
+//		size_t			-		Sort key length
+//		bool			-		true if mergee records are placed ahead of target records on identical keys
+//		BenchRec*		-		Pointer to the array to receive the merged records
+//		double&			-		Reference to the time taken by the merge (ms)
+//
+//  RETURNS:
+//
+//		bool			-		true if the runs were merged, otherwise false
+//
+//  NOTES:
+//
+
+bool	mergeRuns(const BenchRec* pRunA, const BenchRec* pRunB, size_t Records, size_t KL, bool MergeeFirst, BenchRec* pOut, double& Millis) {
+	IStats						Stats;															//  Instrumentation
+	BenchRec					First = pRunA[0];												//  First record of a run
+	SplitStore<BenchRec>*		pA = nullptr;													//  Target store
+	SplitStore<BenchRec>*		pB = nullptr;													//  Mergee store
+	xymorg::TIMER				Start;															//  Start of the merge
+
+	//  Build the stores and flatten them so that only the merge is timed
+	pA = new SplitStore<BenchRec>(First, KL, Stats);
+	pA->addHighKeys(pRunA + 1, Records - 1);
+	First = pRunB[0];
+	pB = new SplitStore<BenchRec>(First, KL, Stats);
+	pB->addHighKeys(pRunB + 1, Records - 1);
+	if (!pA->flatten() || !pB->flatten()) {
+		std::cerr << "ERROR: Unable to flatten the stores for: " << Records << " records." << std::endl;
+		delete pA;
+		delete pB;
+		return false;
+	}
+
+	//  Merge the stores
+	Start = xymorg::CLOCK::now();
+	pA->mergeNextStore(pB, nullptr, MergeeFirst);
+	Millis = std::chrono::duration<double, std::milli>(xymorg::CLOCK::now() - Start).count();
+	if (pA->SRANum != (2 * Records)) {
+		std::cerr << "ERROR: The merge of: " << Records << " + " << Records << " records did not complete." << std::endl;
+		delete pA;
+		return false;
+	}
+
+	//  Return the merged records
+	memcpy(pOut, &pA->pSRA[pA->SRALo], 2 * Records * sizeof(BenchRec));
+	delete pA;
+	return true;
+}
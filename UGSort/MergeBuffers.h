@@ -0,0 +1,251 @@
+#pragma once
+//*******************************************************************************************************************
+//*																													*
+//*   File:       MergeBuffers.h																					*
+//*   Suite:      Experimental Algorithms																			*
+//*   Version:    1.21.0	(Build: 25)																				*
+//*   Author:     Ian Tree/HMNL																						*
+//*																													*
+//*   Copyright 2017 - 2026 Ian J. Tree																				*
+//*******************************************************************************************************************
+//*																													*
+//*	This header file contains the definition for the MergeBuffers template class.									*
+//* The MergeBuffers class manages the Sort Record Arrays (SRA) that are the targets of the merges in the final		*
+//* merge phase. Instead of allocating (and page faulting) a new SRA for every merge and freeing the old ones, two	*
+//* arenas each large enough to hold every record are used alternately, the merges of one round read from one		*
+//* arena and write into the other.																					*
+//*																													*
+//*	NOTES:																											*
+//*																													*
+//*	1.	Target SRAs are carved from the current target arena by a (thread safe) bump allocation.					*
+//*	2.	SRAs that live in an arena are never freed individually, they are dismissed with the arenas.				*
+//*	3.	If the arena cannot satisfy a request then the SRA is allocated from the heap as before.					*
+//*																													*
+//*******************************************************************************************************************
+//*																													*
+//*   History:																										*
+//*																													*
+//*	1.21.0 -	16/10/2026	-	Initial Release																		*
+//*																													*
+//*******************************************************************************************************************/
+
+//  Include xymorg headers
+#include	"../xymorg/xymorg.h"															//  xymorg system headers
+
+//
+//  MergeBuffers Class Template
+//
+
+template <typename T>
+class MergeBuffers {
+public:
+
+	//*******************************************************************************************************************
+	//*                                                                                                                 *
+	//*   Constructors			                                                                                        *
+	//*                                                                                                                 *
+	//*******************************************************************************************************************
+
+	//  Default Constructor
+	//
+	//  Constructs the MergeBuffers object with no arenas allocated
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+
+	MergeBuffers() : ArenaCap(0), Target(1), NextFree(0) {
+
+		pArena[0] = pArena[1] = nullptr;
+
+		//  Return to caller
+		return;
+	}
+
+	//*******************************************************************************************************************
+	//*                                                                                                                 *
+	//*   Destructor			                                                                                        *
+	//*                                                                                                                 *
+	//*******************************************************************************************************************
+
+	//  Destructor
+	//
+	//  Destroys the MergeBuffers object, dismissing both arenas
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+	//	1.	Any SplitStore that holds an SRA in an arena MUST be destroyed before the MergeBuffers object.
+	//
+
+	~MergeBuffers() {
+
+		if (pArena[0] != nullptr) free(pArena[0]);
+		if (pArena[1] != nullptr) free(pArena[1]);
+		pArena[0] = pArena[1] = nullptr;
+
+		//  Return to caller
+		return;
+	}
+
+	//*******************************************************************************************************************
+	//*                                                                                                                 *
+	//*   Public Functions                                                                                              *
+	//*                                                                                                                 *
+	//*******************************************************************************************************************
+
+	//  setCapacity
+	//
+	//  Sets the capacity of each arena, arenas are allocated when first used as a target
+	//
+	//  PARAMETERS:
+	//
+	//		size_t			-		Capacity of each arena (records)
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+
+	void	setCapacity(size_t Capacity) { ArenaCap = Capacity; return; }
+
+	//  startRound
+	//
+	//  Starts a new round of merges, the previous source arena becomes the target arena
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+	//	1.	The caller MUST have relocated any SRA still held in the new target arena (see isTarget()).
+	//
+
+	void	startRound() {
+
+		//  Switch arenas and allocate the new target if not yet allocated
+		Target = Target ^ 1;
+		if (pArena[Target] == nullptr && ArenaCap > 0) pArena[Target] = (T*)malloc(ArenaCap * sizeof(T));
+		NextFree = 0;
+
+		//  Return to caller
+		return;
+	}
+
+	//  isNextTarget
+	//
+	//  Determines if the passed SRA is held in the arena that will be the target of the next round
+	//
+	//  PARAMETERS:
+	//
+	//		T*				-		Const pointer to the SRA
+	//
+	//  RETURNS:
+	//
+	//		bool			-		true if the SRA is held in the next target arena, otherwise false
+	//
+	//  NOTES:
+	//
+
+	bool	isNextTarget(const T* pSRA) const { return inArena(Target ^ 1, pSRA); }
+
+	//  acquire
+	//
+	//  Returns a new SRA for the target of a merge
+	//
+	//  PARAMETERS:
+	//
+	//		size_t			-		Capacity of the SRA (records)
+	//
+	//  RETURNS:
+	//
+	//		T*				-		Pointer to the SRA, nullptr if no storage is available
+	//
+	//  NOTES:
+	//
+	//	1.	May be called concurrently from the final merge worker threads.
+	//
+
+	T* acquire(size_t Capacity) {
+		size_t			Offset = 0;																	//  Offset of the allocation
+
+		//  Carve the SRA from the target arena if there is room
+		if (pArena[Target] != nullptr) {
+			Offset = NextFree.fetch_add(Capacity);
+			if ((Offset + Capacity) <= ArenaCap) return pArena[Target] + Offset;
+		}
+
+		//  Fall back to the heap
+		return (T*)malloc(Capacity * sizeof(T));
+	}
+
+	//  release
+	//
+	//  Releases an SRA that is no longer required
+	//
+	//  PARAMETERS:
+	//
+	//		T*				-		Pointer to the SRA
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+
+	void	release(T* pSRA) {
+		if (pSRA == nullptr) return;
+		if (inArena(0, pSRA) || inArena(1, pSRA)) return;
+		free(pSRA);
+		return;
+	}
+
+private:
+
+	//*******************************************************************************************************************
+	//*                                                                                                                 *
+	//*   Private Members			                                                                                    *
+	//*                                                                                                                 *
+	//*******************************************************************************************************************
+
+	T*						pArena[2];														//  The two arenas
+	size_t					ArenaCap;														//  Capacity of each arena (records)
+	int						Target;															//  Index of the current target arena
+	std::atomic<size_t>		NextFree;														//  Next free record in the target arena
+
+	//*******************************************************************************************************************
+	//*                                                                                                                 *
+	//*   Private Functions                                                                                             *
+	//*                                                                                                                 *
+	//*******************************************************************************************************************
+
+	//  inArena
+	//
+	//  Determines if the passed SRA is held in the designated arena
+	//
+	//  PARAMETERS:
+	//
+	//		int				-		Arena index
+	//		T*				-		Const pointer to the SRA
+	//
+	//  RETURNS:
+	//
+	//		bool			-		true if the SRA is held in the arena, otherwise false
+	//
+	//  NOTES:
+	//
+
+	bool	inArena(int Arena, const T* pSRA) const {
+		if (pArena[Arena] == nullptr) return false;
+		if (pSRA < pArena[Arena]) return false;
+		if (pSRA >= pArena[Arena] + ArenaCap) return false;
+		return true;
+	}
+
+};
@@ -0,0 +1,294 @@
+#pragma once
+//*******************************************************************************************************************
+//*																													*
+//*   File:       PMPolicy.h																						*
+//*   Suite:      Experimental Algorithms																			*
+//*   Version:    1.33.0	(Build: 37)																				*
+//*   Author:     Ian Tree/HMNL																						*
+//*																													*
+//*   Copyright 2017 - 2026 Ian J. Tree																				*
+//*******************************************************************************************************************
+//*																													*
+//*	This header file contains the definition for the PMPolicy class.												*
+//* The PMPolicy class holds the selection and tuning of the preemptive merge (PM) strategy that is applied by a	*
+//* Splitter. The policy decides when a PM is triggered (the store count trigger) and which stores are merged.		*
+//*																													*
+//*	STRATEGIES:																										*
+//*																													*
+//*	tail		-	Stores are swept up from the tail of the chain, m/n of the chain is merged (default 1/10).		*
+//*	head		-	Stores are swept up into the head of the chain, m/n of the chain is merged.						*
+//*	alternate	-	Alternate stores are merged into their predecessors, halving the chain.							*
+//*	tiered		-	The adjacent pair of stores with the fewest records is merged until m/n of the chain is merged.	*
+//*	budget		-	As tail, however the trigger is fixed by a memory budget for the store chain overhead.			*
+//*	lsm			-	Size tiered compaction, tier t holds stores of F^t to F^(t+1) - 1 records. When more than N		*
+//*					adjacent stores are in the same tier they are merged into a single store.						*
+//*																													*
+//*	NOTES:																											*
+//*																													*
+//*	1.	Only adjacent stores are ever merged so the nesting of the store key ranges is preserved by every strategy.	*
+//*	2.	Except for the budget strategy the trigger is recomputed after each PM as i% of 2*sqrt(n/2).				*
+//*	3.	The head store is normally the largest store, the head strategy copies it once at every PM and is only		*
+//*		useful when the input is nearly sorted.																		*
+//*	4.	The tail and budget strategies can merge the tail in the background while insertion continues on the head	*
+//*		of the chain.																								*
+//*	5.	The tail and budget strategies can instead amortise the merge of the tail, each insertion moves at most q	*
+//*		records of the merge so that no single insertion waits for a complete PM.									*
+//*	6.	The lsm strategy is checked whenever a store is added to the chain, the store count trigger is only a		*
+//*		backstop.																									*
+//*																													*
+//*******************************************************************************************************************
+//*																													*
+//*   History:																										*
+//*																													*
+//*	1.28.0 -	16/10/2026	-	Initial Release																		*
+//*	1.29.0 -	16/10/2026	-	Single pass k-way tail suppression													*
+//*	1.31.0 -	16/10/2026	-	Background preemptive merge															*
+//*	1.32.0 -	16/10/2026	-	Amortised preemptive merge															*
+//*	1.33.0 -	16/10/2026	-	Size tiered store compaction														*
+//*																													*
+//*******************************************************************************************************************/
+
+//  Include xymorg headers
+#include	"../xymorg/xymorg.h"															//  xymorg system headers
+
+//  Strategies
+#define		PMP_TAIL			0															//  Tail suppression
+#define		PMP_HEAD			1															//  Head suppression
+#define		PMP_ALTERNATE		2															//  Alternate store merge
+#define		PMP_TIERED			3															//  Size tiered merge
+#define		PMP_BUDGET			4															//  Memory budget driven tail suppression
+#define		PMP_LSM				5															//  Size tiered (LSM) compaction
+
+//
+//		PMPolicy Class definition
+//
+
+class PMPolicy {
+public:
+	//*******************************************************************************************************************
+	//*                                                                                                                 *
+	//*   Constructors			                                                                                        *
+	//*                                                                                                                 *
+	//*******************************************************************************************************************
+
+	//  Default Constructor
+	//
+	//  Constructs the PMPolicy with the application defaults (tail suppression of 1/10 of the chain)
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+
+	PMPolicy() : Strategy(PMP_TAIL), MaxStores(100), MaxInc(25), MergeCount(1), PatternCount(10), BudgetMB(16), Background(false), Quantum(0), TierStores(4), TierRatio(4) {
+
+		//  Return to caller
+		return;
+	}
+
+	//*******************************************************************************************************************
+	//*                                                                                                                 *
+	//*   Public Members                                                                                                *
+	//*                                                                                                                 *
+	//*******************************************************************************************************************
+
+	int				Strategy;																//  PM strategy (PMP_xxx)
+	size_t			MaxStores;																//  Initial store count trigger (s)
+	size_t			MaxInc;																	//  Percentage of S for the trigger (i)
+	size_t			MergeCount;																//  Merge count of the pattern (m)
+	size_t			PatternCount;															//  Count of the pattern (n)
+	size_t			BudgetMB;																//  Store chain overhead budget (MB)
+	bool			Background;																//  Tail is merged by a background thread
+	size_t			Quantum;																//  Records moved per insertion by an amortised PM (0 = not amortised)
+	size_t			TierStores;																//  Adjacent stores allowed in a tier (N)
+	size_t			TierRatio;																//  Size ratio between tiers (F)
+
+	//*******************************************************************************************************************
+	//*                                                                                                                 *
+	//*   Public Functions                                                                                              *
+	//*                                                                                                                 *
+	//*******************************************************************************************************************
+
+	//  setStrategy
+	//
+	//  Sets the strategy from the passed strategy name
+	//
+	//  PARAMETERS:
+	//
+	//		char*			-		Const pointer to the strategy name
+	//		size_t			-		Length of the name
+	//
+	//  RETURNS:
+	//
+	//		bool			-		true if the name is a valid strategy, otherwise false
+	//
+	//  NOTES:
+	//
+
+	bool	setStrategy(const char* pName, size_t NameLen) {
+
+		for (int sIndex = PMP_TAIL; sIndex <= PMP_LSM; sIndex++) {
+			if (NameLen == strlen(getStrategyName(sIndex)) && _memicmp(pName, getStrategyName(sIndex), NameLen) == 0) {
+				Strategy = sIndex;
+				return true;
+			}
+		}
+
+		//  Return showing an invalid strategy
+		return false;
+	}
+
+	//  getStrategyName
+	//
+	//  Returns the name of the passed strategy
+	//
+	//  PARAMETERS:
+	//
+	//		int				-		Strategy (PMP_xxx)
+	//
+	//  RETURNS:
+	//
+	//		char*			-		Const pointer to the name of the strategy
+	//
+	//  NOTES:
+	//
+
+	static const char* getStrategyName(int Strat) {
+		switch (Strat) {
+		case PMP_TAIL: return "tail";
+		case PMP_HEAD: return "head";
+		case PMP_ALTERNATE: return "alternate";
+		case PMP_TIERED: return "tiered";
+		case PMP_BUDGET: return "budget";
+		case PMP_LSM: return "lsm";
+		}
+		return "unknown";
+	}
+
+	//  getMerges
+	//
+	//  Returns the number of stores to be eliminated by a PM over a chain of the passed number of stores
+	//
+	//  PARAMETERS:
+	//
+	//		size_t			-		Number of stores in the chain
+	//
+	//  RETURNS:
+	//
+	//		size_t			-		Number of stores to be merged into their neighbours
+	//
+	//  NOTES:
+	//
+	//	1.	At least one store is merged and at least one store remains.
+	//
+
+	size_t	getMerges(size_t Stores) const {
+		size_t			Merges = 0;																//  Stores to be merged
+
+		if (Stores < 2) return 0;
+		if (Strategy == PMP_ALTERNATE) return Stores / 2;
+		Merges = Stores - ((Stores * (PatternCount - MergeCount)) / PatternCount);
+		if (Merges == 0) Merges = 1;
+		if (Merges >= Stores) Merges = Stores - 1;
+		return Merges;
+	}
+
+	//  getTrigger
+	//
+	//  Returns the store count that will trigger the next PM
+	//
+	//  PARAMETERS:
+	//
+	//		size_t			-		Current trigger
+	//		size_t			-		Current record count
+	//		size_t			-		Overhead of a single store (bytes)
+	//
+	//  RETURNS:
+	//
+	//		size_t			-		New trigger
+	//
+	//  NOTES:
+	//
+	//	1.	The triggers for the budget and lsm strategies are fixed, otherwise the trigger never decreases.
+	//	2.	The lsm trigger is only a backstop, the lsm strategy normally merges stores as soon as a tier is full.
+	//
+
+	size_t	getTrigger(size_t Current, size_t Records, size_t StoreCost) const {
+		size_t			NewMS = 0;																//  New Max Stores
+		size_t			CurrentS = 0;															//  Current S
+
+		//  Budget - the number of stores that the budget will accomodate
+		if (Strategy == PMP_BUDGET) {
+			NewMS = (BudgetMB * 1024 * 1024) / StoreCost;
+			if (NewMS < 2) NewMS = 2;
+			return NewMS;
+		}
+
+		//  LSM - room for N stores in each of the tiers that a 64 bit record count can reach
+		if (Strategy == PMP_LSM) return (TierStores + 1) * 64;
+
+		//  Compute S for the current value of n S = 2*sqrt(n/2)
+		CurrentS = size_t(ceil(sqrt(double(Records / 2)) * 2.0));
+
+		//  Compute new MaxS
+		NewMS = (CurrentS * MaxInc) / 100;
+
+		//  Return the computed new max stores providing it is greater than the existing value
+		if (NewMS > Current) return NewMS;
+		return Current;
+	}
+
+	//  getTier
+	//
+	//  Returns the size tier of a store holding the passed number of records
+	//
+	//  PARAMETERS:
+	//
+	//		size_t			-		Number of records in the store
+	//
+	//  RETURNS:
+	//
+	//		size_t			-		Tier of the store, tier t holds F^t to F^(t+1) - 1 records
+	//
+	//  NOTES:
+	//
+
+	size_t	getTier(size_t Records) const {
+		size_t			Tier = 0;																//  Tier
+
+		while (Records >= TierRatio) {
+			Records = Records / TierRatio;
+			Tier++;
+		}
+		return Tier;
+	}
+
+	//  isValid
+	//
+	//  Determines if the tuning parameters are valid
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//		bool			-		true if the parameters are valid, otherwise false
+	//
+	//  NOTES:
+	//
+	//	1.	Only the tail strategies can be run in the background or amortised, the other strategies merge stores at
+	//		the head. A PM is either run in the background or amortised, not both.
+	//
+
+	bool	isValid() const {
+		if (MaxStores < 2) return false;
+		if (PatternCount == 0 || MergeCount == 0 || MergeCount > PatternCount) return false;
+		if (Strategy == PMP_BUDGET && BudgetMB == 0) return false;
+		if (Strategy == PMP_LSM && (TierStores == 0 || TierRatio < 2)) return false;
+		if (Background && Strategy != PMP_TAIL && Strategy != PMP_BUDGET) return false;
+		if (Quantum > 0 && (Background || (Strategy != PMP_TAIL && Strategy != PMP_BUDGET))) return false;
+		return true;
+	}
+
+};
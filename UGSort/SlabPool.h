@@ -0,0 +1,356 @@
+#pragma once
+//*******************************************************************************************************************
+//*																													*
+//*   File:       SlabPool.h																						*
+//*   Suite:      Experimental Algorithms																			*
+//*   Version:    1.35.0	(Build: 39)																				*
+//*   Author:     Ian Tree/HMNL																						*
+//*																													*
+//*   Copyright 2017 - 2026 Ian J. Tree																				*
+//*******************************************************************************************************************
+//*																													*
+//*	This header file contains the definition for the SlabPool class.												*
+//* The SlabPool class is a fixed size slot allocator, slots are carved from large slabs and released slots are		*
+//* held on a free list for reuse. The Splitter uses one pool for the SplitStore objects and one for the initial	*
+//* Sort Record Arrays (SRA) and segments of the stores, preemptive merges create and destroy these at a very high	*
+//* rate.																											*
+//*																													*
+//*	NOTES:																											*
+//*																													*
+//*	1.	Slots are never returned to the heap individually, the slabs are dismissed with the pool.					*
+//*	2.	Slots may be acquired and released concurrently (background PM and final merge worker threads).				*
+//*	3.	A pool may adopt another pool, the adopted pool (and its slots) then lives as long as the adopting pool.	*
+//*																													*
+//*******************************************************************************************************************
+//*																													*
+//*   History:																										*
+//*																													*
+//*	1.34.0 -	16/10/2026	-	Initial Release																		*
+//*	1.35.0 -	16/10/2026	-	Segmented double ended SRA storage													*
+//*																													*
+//*******************************************************************************************************************/
+
+//  Include xymorg headers
+#include	"../xymorg/xymorg.h"															//  xymorg system headers
+
+//
+//  SlabPool Class
+//
+
+class SlabPool {
+private:
+	//*******************************************************************************************************************
+	//*                                                                                                                 *
+	//*   Private Constants		                                                                                        *
+	//*                                                                                                                 *
+	//*******************************************************************************************************************
+
+	static const size_t	SlabBytes = 256 * 1024;											//  Target size of a slab
+	static const size_t	MinSlots = 16;													//  Minimum slots in a slab
+	static const size_t	SlabHdr = 64;													//  Slab header size (keeps slots cache aligned)
+
+	//*******************************************************************************************************************
+	//*                                                                                                                 *
+	//*   Private Nested Structures                                                                                     *
+	//*                                                                                                                 *
+	//*******************************************************************************************************************
+
+	//  Slab header
+	typedef struct Slab {
+		Slab*		pNext;																//  Next slab in the pool
+	} Slab;
+
+	//  Free slot
+	typedef struct FreeSlot {
+		FreeSlot*	pNext;																//  Next free slot
+	} FreeSlot;
+
+public:
+
+	//*******************************************************************************************************************
+	//*                                                                                                                 *
+	//*   Constructors			                                                                                        *
+	//*                                                                                                                 *
+	//*******************************************************************************************************************
+
+	//  Constructor
+	//
+	//  Constructs the SlabPool for slots of the requested size, no slab is allocated until the first slot is acquired
+	//
+	//  PARAMETERS:
+	//
+	//		size_t			-		Size of a slot (bytes)
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+
+	SlabPool(size_t Size) : pSlabs(nullptr), pFree(nullptr), pNextFree(nullptr), SlabEnd(0), Slabs(0), pAdopted(nullptr), pNextAdopted(nullptr) {
+
+		//  Slots are rounded up to a multiple of 16 bytes
+		SlotSize = (Size + 15) & ~size_t(15);
+		if (SlotSize == 0) SlotSize = 16;
+		SlotsPerSlab = SlabBytes / SlotSize;
+		if (SlotsPerSlab < MinSlots) SlotsPerSlab = MinSlots;
+		Lock.clear();
+
+		//  Return to caller
+		return;
+	}
+
+	//*******************************************************************************************************************
+	//*                                                                                                                 *
+	//*   Destructor			                                                                                        *
+	//*                                                                                                                 *
+	//*******************************************************************************************************************
+
+	//  Destructor
+	//
+	//  Destroys the SlabPool, dismissing every slab and every adopted pool
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+	//	1.	Every object that holds a slot from the pool (or an adopted pool) MUST be destroyed before the pool.
+	//
+
+	~SlabPool() {
+		Slab*		pSlab = nullptr;													//  Slab to be freed
+		SlabPool*	pPool = nullptr;													//  Adopted pool to be deleted
+
+		//  Free the slabs
+		while (pSlabs != nullptr) {
+			pSlab = pSlabs;
+			pSlabs = pSlab->pNext;
+			free(pSlab);
+		}
+
+		//  Delete the adopted pools
+		while (pAdopted != nullptr) {
+			pPool = pAdopted;
+			pAdopted = pPool->pNextAdopted;
+			pPool->pNextAdopted = nullptr;
+			delete pPool;
+		}
+
+		//  Return to caller
+		return;
+	}
+
+	//*******************************************************************************************************************
+	//*                                                                                                                 *
+	//*   Public Functions                                                                                              *
+	//*                                                                                                                 *
+	//*******************************************************************************************************************
+
+	//  acquire
+	//
+	//  Returns a free slot from the pool
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//		void*			-		Pointer to the slot, nullptr if no storage is available
+	//
+	//  NOTES:
+	//
+
+	void* acquire() {
+		void*		pSlot = nullptr;													//  Slot acquired
+
+		lock();
+
+		//  Reuse a released slot if there is one
+		if (pFree != nullptr) {
+			pSlot = pFree;
+			pFree = pFree->pNext;
+			unlock();
+			return pSlot;
+		}
+
+		//  Start a new slab if the current one is exhausted
+		if (SlabEnd == 0) {
+			if (!addSlab()) {
+				unlock();
+				return nullptr;
+			}
+		}
+
+		//  Carve the next slot from the current slab
+		pSlot = pNextFree;
+		pNextFree += SlotSize;
+		SlabEnd--;
+
+		unlock();
+		return pSlot;
+	}
+
+	//  release
+	//
+	//  Returns a slot to the pool
+	//
+	//  PARAMETERS:
+	//
+	//		void*			-		Pointer to the slot
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+
+	void	release(void* pSlot) {
+		if (pSlot == nullptr) return;
+
+		lock();
+		((FreeSlot*) pSlot)->pNext = pFree;
+		pFree = (FreeSlot*) pSlot;
+		unlock();
+
+		//  Return to caller
+		return;
+	}
+
+	//  adopt
+	//
+	//  Takes ownership of the passed pool, it is deleted with this pool
+	//
+	//  PARAMETERS:
+	//
+	//		SlabPool*		-		Pointer to the pool to be adopted
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+	//	1.	Slots of the adopted pool continue to be released to it, the adopted pool is not merged into this pool.
+	//
+
+	void	adopt(SlabPool* pDonor) {
+		if (pDonor == nullptr || pDonor == this) return;
+		pDonor->pNextAdopted = pAdopted;
+		pAdopted = pDonor;
+		return;
+	}
+
+	//  getSlotSize
+	//
+	//  Returns the size of the slots in the pool
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//		size_t			-		Size of a slot (bytes)
+	//
+	//  NOTES:
+	//
+
+	size_t	getSlotSize() const { return SlotSize; }
+
+	//  getSlabs
+	//
+	//  Returns the number of slabs allocated by the pool
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//		size_t			-		Number of slabs
+	//
+	//  NOTES:
+	//
+
+	size_t	getSlabs() const { return Slabs; }
+
+private:
+
+	//*******************************************************************************************************************
+	//*                                                                                                                 *
+	//*   Private Members			                                                                                    *
+	//*                                                                                                                 *
+	//*******************************************************************************************************************
+
+	size_t				SlotSize;														//  Size of a slot (bytes)
+	size_t				SlotsPerSlab;													//  Number of slots in a slab
+	Slab*				pSlabs;															//  Chain of slabs
+	FreeSlot*			pFree;															//  Chain of released slots
+	char*				pNextFree;														//  Next unused slot in the current slab
+	size_t				SlabEnd;														//  Unused slots remaining in the current slab
+	size_t				Slabs;															//  Number of slabs allocated
+	SlabPool*			pAdopted;														//  Chain of adopted pools
+	SlabPool*			pNextAdopted;													//  Next pool adopted by the same owner
+	std::atomic_flag	Lock;															//  Spin lock
+
+	//*******************************************************************************************************************
+	//*                                                                                                                 *
+	//*   Private Functions                                                                                             *
+	//*                                                                                                                 *
+	//*******************************************************************************************************************
+
+	//  addSlab
+	//
+	//  Allocates a new slab and makes it the current slab
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//		bool			-		true if the slab was allocated, otherwise false
+	//
+	//  NOTES:
+	//
+	//	1.	The caller MUST hold the lock.
+	//
+
+	bool	addSlab() {
+		Slab*		pSlab = (Slab*) malloc(SlabHdr + (SlotsPerSlab * SlotSize));		//  New slab
+
+		if (pSlab == nullptr) return false;
+		pSlab->pNext = pSlabs;
+		pSlabs = pSlab;
+		pNextFree = ((char*) pSlab) + SlabHdr;
+		SlabEnd = SlotsPerSlab;
+		Slabs++;
+
+		//  Return showing success
+		return true;
+	}
+
+	//  lock
+	//
+	//  Acquires the pool spin lock
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+
+	void	lock() {
+		while (Lock.test_and_set(std::memory_order_acquire)) std::this_thread::yield();
+		return;
+	}
+
+	//  unlock
+	//
+	//  Releases the pool spin lock
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+
+	void	unlock() {
+		Lock.clear(std::memory_order_release);
+		return;
+	}
+
+};
@@ -3,7 +3,7 @@
 //*																													*
 //*   File:       Sorter.h																							*
 //*   Suite:      Experimental Algorithms																			*
-//*   Version:    1.17.0	(Build: 20)																				*
+//*   Version:    1.42.0	(Build: 46)																				*
 //*   Author:     Ian Tree/HMNL																						*
 //*																													*
 //*   Copyright 2017 - 2026 Ian J. Tree																				*
@@ -35,6 +35,20 @@
 //*	1.14.0 -	08/07/2023	-	Remove T_SO sub-phase timing and clarify timings									*
 //*	1.15.0 -	25/08/2023	-	Binary-Chop search of Store Chain													*
 //*	1.17.0 -	28/01/2026	-	Include instrumentation package														*
+//*	1.18.0 -	16/10/2026	-	Multi-threaded final merge															*
+//*	1.19.0 -	16/10/2026	-	Merge-path partitioned merges														*
+//*	1.20.0 -	16/10/2026	-	Streamed k-way (loser tree) final merge												*
+//*	1.22.0 -	16/10/2026	-	Inline key prefix in sort records													*
+//*	1.23.0 -	16/10/2026	-	Comparator policy template parameter												*
+//*	1.25.0 -	16/10/2026	-	Natural run detection with bulk insertion											*
+//*	1.26.0 -	16/10/2026	-	Range partitioned parallel sort														*
+//*	1.27.0 -	16/10/2026	-	Chunk parallel sort with store adoption												*
+//*	1.28.0 -	16/10/2026	-	Selectable preemptive merge policy													*
+//*	1.30.0 -	16/10/2026	-	Size ordered final merge schedule													*
+//*	1.36.0 -	16/10/2026	-	Finger search of the store chain													*
+//*	1.37.0 -	16/10/2026	-	Compact sort record formats															*
+//*	1.40.0 -	16/10/2026	-	Runtime processor feature dispatch													*
+//*	1.42.0 -	16/10/2026	-	Common sort key prefix elimination													*
 //*																													*
 //*******************************************************************************************************************/
 
@@ -43,8 +57,14 @@
 
 //  Application Headers
 #include	"IStats.h"																		//  Instrumentation
+#include	"CPUDispatch.h"																	//  Processor feature dispatch
 #include	"Splitter.h"																	//  Splitter template class
 
+//  Constants
+#define		RUN_BLOCK		4096																//  Records per block for run insertion
+#define		INDEX32_LIMIT	((size_t(1) << 32) - 16)										//  Sort input size limit for 4 byte index records
+#define		INDEX40_LIMIT	((size_t(1) << 40) - 16)										//  Sort input size limit for 5 byte index records
+
 //
 //  Sorter class definition
 //
@@ -70,12 +90,110 @@ private:
 		std::streampos	RecPos;													//  Record position in Sortin
 	} ODSR;
 
+	//  Sort Record for In-Memory sorting with an inline key prefix
+	typedef struct IMSRP {
+		const char* pKey;													//  Pointer tho the Sort Key
+		const char* pRec;													//  Pointer to the in-memory record
+		uint64_t		KeyPfx;													//  First 8 bytes of the key (big-endian)
+	} IMSRP;
+
+	//  Sort Record for On-Disk sorting with an inline key prefix
+	typedef struct ODSRP {
+		const char* pKey;													//  Pointer tho the Sort Key
+		std::streampos	RecPos;													//  Record position in Sortin
+		uint64_t		KeyPfx;													//  First 8 bytes of the key (big-endian)
+	} ODSRP;
+
+	//  Base of the in-memory sort input for the compact index sort records
+	typedef struct SRIBase {
+		static const char*& rec() { static const char* pRecBase = nullptr; return pRecBase; }
+		static const char*& key() { static const char* pKeyBase = nullptr; return pKeyBase; }
+	} SRIBase;
+
+	//  Compact Sort Record for In-Memory sorting, the record is located from the key (pKey - SKOff)
+	typedef struct IMSRK {
+		const char*		pKey;													//  Pointer tho the Sort Key
+		void			bind(const char* pRec, size_t SKOff) { pKey = pRec + SKOff; return; }
+		const char*		rec(size_t SKOff) const { return pKey - SKOff; }
+	} IMSRK;
+
+	//  Compact Index Sort Record for In-Memory sorting of inputs below 4 GB, the key and the record are located from
+	//  the offset of the record in the sort input
+	typedef struct IMSRI {
+		uint32_t		RecOff;													//  Offset of the record in the sort input
+		void			bind(const char* pRec, size_t) { RecOff = uint32_t(pRec - SRIBase::rec()); return; }
+		const char*		rec(size_t) const { return SRIBase::rec() + RecOff; }
+		const char*		key() const { return SRIBase::key() + RecOff; }
+	} IMSRI;
+
+	//  Compact Index Sort Record for In-Memory sorting of inputs below 1 TB (40 bit offset)
+#pragma pack(push, 1)
+	typedef struct IMSRI5 {
+		uint32_t		RecOffLo;												//  Offset of the record in the sort input (low 32 bits)
+		uint8_t			RecOffHi;												//  Offset of the record in the sort input (high 8 bits)
+		void			bind(const char* pRec, size_t) {
+			uint64_t	Off = uint64_t(pRec - SRIBase::rec());
+			RecOffLo = uint32_t(Off);
+			RecOffHi = uint8_t(Off >> 32);
+			return;
+		}
+		size_t			off() const { return (size_t(RecOffHi) << 32) | size_t(RecOffLo); }
+		const char*		rec(size_t) const { return SRIBase::rec() + off(); }
+		const char*		key() const { return SRIBase::key() + off(); }
+	} IMSRI5;
+#pragma pack(pop)
+
+	//  Compact Sort Record for On-Disk sorting, the record position is held as a 64 bit offset
+	typedef struct ODSRC {
+		const char* pKey;													//  Pointer tho the Sort Key
+		uint64_t		RecPos;													//  Record position in Sortin
+	} ODSRC;
+
 	//  Sort Record for Memory Array sorting
 	typedef struct MASR {
 		const char* pKey;													//  Pointer tho the Sort Key
 		size_t			AEX;													//  Array Element index
 	} MASR;
 
+	//*******************************************************************************************************************
+	//*                                                                                                                 *
+	//*   Private Nested Structures	(Engine Dispatch)                                                                   *
+	//*                                                                                                                 *
+	//*******************************************************************************************************************
+
+	//  Parameters of a sort, passed from a dispatcher to the engine
+	typedef struct SortArgs {
+		const char*		SFIn;													//  Sort input file name
+		const char*		SFOut;													//  Sort output file name
+		size_t			MaxRecl;												//  Maximum record length (on-disk)
+		size_t			SKOff;													//  Offset to the sort key
+		size_t			SKLen;													//  Length of the sort key
+		bool			Ascending;												//  Sort sequence is ascending
+		bool			PMEnabled;												//  Preemptive merging is enabled
+		IStats&			Stats;													//  Statistics collector/reporter
+	} SortArgs;
+
+	//  Engine invokers, each runs its engine for the sort record type R and key comparator C
+	typedef struct InMemoryEngine {
+		template <typename R, typename C>
+		static bool		run(Sorter& S, const SortArgs& A) { return S.sortInMemory<R, C>(A.SFIn, A.SFOut, A.SKOff, A.SKLen, A.Ascending, A.PMEnabled, A.Stats); }
+	} InMemoryEngine;
+
+	typedef struct StableInMemoryEngine {
+		template <typename R, typename C>
+		static bool		run(Sorter& S, const SortArgs& A) { return S.sortStableInMemory<R, C>(A.SFIn, A.SFOut, A.SKOff, A.SKLen, A.Ascending, A.PMEnabled, A.Stats); }
+	} StableInMemoryEngine;
+
+	typedef struct OnDiskEngine {
+		template <typename R, typename C>
+		static bool		run(Sorter& S, const SortArgs& A) { return S.sortOnDisk<R, C>(A.SFIn, A.SFOut, A.MaxRecl, A.SKOff, A.SKLen, A.Ascending, A.PMEnabled, A.Stats); }
+	} OnDiskEngine;
+
+	typedef struct StableOnDiskEngine {
+		template <typename R, typename C>
+		static bool		run(Sorter& S, const SortArgs& A) { return S.sortStableOnDisk<R, C>(A.SFIn, A.SFOut, A.MaxRecl, A.SKOff, A.SKLen, A.Ascending, A.PMEnabled, A.Stats); }
+	} StableOnDiskEngine;
+
 public:
 
 	//*******************************************************************************************************************
@@ -97,7 +215,7 @@ public:
 	//  NOTES:
 	//
 
-	Sorter(std::ostream& RefOS) : Log(RefOS), Notifications(false), Timings(false) {
+	Sorter(std::ostream& RefOS) : Log(RefOS), Notifications(false), Timings(false), Threads(1), MergePathMin(1000000), StreamFM(false), SizedFM(false), KeyPrefix(false), RunInsert(false), FingerSearch(false), PointerRecords(false), IndexRecords(false), CommonPrefix(false), pPreload(nullptr), PreloadSize(0) {
 
 		//  Return to caller
 		return;
@@ -122,6 +240,9 @@ public:
 
 	~Sorter() {
 
+		//  Free any sort input image that was not taken by an engine
+		if (pPreload != nullptr) freeImage(pPreload);
+
 		//  Return to caller
 		return;
 	}
@@ -166,6 +287,169 @@ public:
 
 	void	enableTimings() { Timings = true; return; }
 
+	//  setThreads
+	//
+	//  This function sets the number of threads that the Sorter may use for the parallel phases of the sort.
+	//
+	//  PARAMETERS:
+	//
+	//		size_t		-		Number of threads, 0 = hardware concurrency, 1 = single threaded
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+
+	void	setThreads(size_t NewThreads) { Threads = NewThreads; return; }
+
+	//  setMergePathThreshold
+	//
+	//  This function sets the minimum number of records in a single merge for the merge to be partitioned across threads.
+	//
+	//  PARAMETERS:
+	//
+	//		size_t		-		Minimum number of records
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+
+	void	setMergePathThreshold(size_t Threshold) { MergePathMin = Threshold; return; }
+
+	//  enableStreamedMerge
+	//
+	//  This function will enable the streamed (k-way) final merge, records are merged directly into the sort output.
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+
+	void	enableStreamedMerge() { StreamFM = true; return; }
+
+	//  enableSizedMerge
+	//
+	//  This function will enable the size ordered final merge, the adjacent pair of stores with the fewest records is
+	//  always merged next.
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+
+	void	enableSizedMerge() { SizedFM = true; return; }
+
+	//  enableFingerSearch
+	//
+	//  This function will enable the finger search of the store chain, the store to receive each key is searched for
+	//  outwards from the store that received the previous key.
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+
+	void	enableFingerSearch() { FingerSearch = true; return; }
+
+	//  enableKeyPrefix
+	//
+	//  This function will enable the sort record layout that holds the first 8 bytes of the key inline in the record.
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+
+	void	enableKeyPrefix() { KeyPrefix = true; return; }
+
+	//  enableRunInsertion
+	//
+	//  This function will enable the detection of ascending and descending runs in the (in-memory) sort input, each
+	//  run is added to the store that receives it in a single copy.
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+
+	void	enableRunInsertion() { RunInsert = true; return; }
+
+	//  enablePointerRecords
+	//
+	//  This function will enable the compact sort record layouts that hold a single pointer to the sort key, the record
+	//  is located from the key. On-disk sorts hold the record position as a 64 bit offset.
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+	//	1.	The inline key prefix layout takes precedence.
+	//
+
+	void	enablePointerRecords() { PointerRecords = true; return; }
+
+	//  enableIndexRecords
+	//
+	//  This function will enable the compact index sort record layouts for in-memory sorts, each record holds only the
+	//  (32 or 40 bit) offset of the record in the sort input. On-disk sorts use the compact pointer layout.
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+	//	1.	The inline key prefix layout takes precedence.
+	//	2.	Sort inputs of 1 TB or more use the compact pointer layout.
+	//
+
+	void	enableIndexRecords() { IndexRecords = true; return; }
+
+	//  enableCommonPrefix
+	//
+	//  This function will enable the elimination of the prefix that is common to every sort key, the sort is then
+	//  performed on the remainder of the key only.
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+	//	1.	In-memory sorts scan the loaded sort input, on-disk sorts make a streaming pass over the sort input.
+	//	2.	The scan stops as soon as the first byte of the keys differs.
+	//
+
+	void	enableCommonPrefix() { CommonPrefix = true; return; }
+
+	//  setPMPolicy
+	//
+	//  This function sets the preemptive merge policy that is applied by every Splitter used in a sort.
+	//
+	//  PARAMETERS:
+	//
+	//		PMPolicy&	-		Const reference to the policy
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+
+	void	setPMPolicy(const PMPolicy& Policy) { PMP = Policy; return; }
+
 	//  Application Sorting API
 
 	//  sortFileInMemory
@@ -197,19 +481,61 @@ public:
 		bool Ascending,
 		bool PMEnabled,
 		IStats& Stats) {
+		size_t		SISize = 0;																		//  Sort input size (index records)
+
+		//  Eliminate the common sort key prefix, the sort input is loaded by the scan
+		if (CommonPrefix && !eliminateCommonPrefix(SFIn, SKOff, SKLen, Stats)) return false;
+
+		//  Sort parameters for the engine
+		SortArgs	Args = { SFIn, SFOut, 0, SKOff, SKLen, Ascending, PMEnabled, Stats };
+
+		//  Dispatch to the engine for the selected sort record layout and key length
+		if (KeyPrefix) return dispatchKeyLength<IMSRP, InMemoryEngine>(Args);
+		if (IndexRecords) SISize = getSortInputSize(SFIn);
+		if (IndexRecords && (SISize > 0) && (SISize < INDEX32_LIMIT)) return sortInMemory<IMSRI, VarKeyCompare>(SFIn, SFOut, SKOff, SKLen, Ascending, PMEnabled, Stats);
+		if (IndexRecords && (SISize > 0) && (SISize < INDEX40_LIMIT)) return sortInMemory<IMSRI5, VarKeyCompare>(SFIn, SFOut, SKOff, SKLen, Ascending, PMEnabled, Stats);
+		if (PointerRecords || IndexRecords) return sortInMemory<IMSRK, VarKeyCompare>(SFIn, SFOut, SKOff, SKLen, Ascending, PMEnabled, Stats);
+		return dispatchKeyLength<IMSR, InMemoryEngine>(Args);
+	}
+
+	//  sortInMemory
+	//
+	//  This function is the implementation of sortFileInMemory() for the sort record type R and key comparator C.
+	//
+	//  PARAMETERS:
+	//
+	//		As sortFileInMemory()
+	//
+	//  RETURNS:
+	//
+	//		bool		-		true if the sort was completed, otherwise false.
+	//
+	//  NOTES:
+	//
+
+	template <typename R, typename C>
+	bool	sortInMemory(const char* SFIn,
+		const char* SFOut,
+		size_t SKOff,
+		size_t SKLen,
+		bool Ascending,
+		bool PMEnabled,
+		IStats& Stats) {
 
 		char*					pSortin = nullptr;														//  Sort input in-memory buffer
 		char*					pSortout = nullptr;														//  Sort output in-memory buffer
 		size_t					SISize = 0;																//  Sort input size
 		char*					pEOI = nullptr;															//  Pointer to the End-Of-Input
 		char*					pNextRec = nullptr;														//  Pointer to the next record
-		IMSR					SRec = {};																//  In-Memory sort record (internal)
+		R						SRec = {};																//  In-Memory sort record (internal)
+		R*						pBlock = nullptr;														//  Block of records for run insertion
+		size_t					BlockRecs = 0;															//  Records in the block
 
 		//  Root Splitter of the Splitter chain
-		Splitter<IMSR>* pSR = nullptr;
+		Splitter<R, C>* pSR = nullptr;
 
-		//  Load the designated sort input into memory
-		Stats.startLoading();
+		//  Load the designated sort input into memory (unless already loaded by the common prefix scan)
+		if (pPreload == nullptr) Stats.startLoading();
 		pSortin = loadSortInput(SFIn, SISize);
 		if (pSortin == nullptr) {
 			Log << "ERROR: Failed to load the sort input into memory, it may be too big to sort in-memory." << std::endl;
@@ -223,42 +549,70 @@ public:
 		pEOI = pSortin + SISize;
 		pNextRec = pSortin;																				//  Next record is the first
 
+		//  Establish the base of the sort input for index sort records
+		SRIBase::rec() = pSortin;
+		SRIBase::key() = pSortin + SKOff;
+
 		//  Setup the initial sort record
-		SRec.pRec = pNextRec;
-		SRec.pKey = pNextRec + SKOff;
+		bindRecord(SRec, pNextRec, SKOff);
+		setKeyPrefix(SRec, SKLen);
 
 		//  Adjust the next record pointer
-		pNextRec = strchr(pNextRec, SCHAR_LF);
+		pNextRec = CPUDispatch::findLF(pNextRec);
 		if (pNextRec == nullptr) pNextRec = pEOI;
 		else pNextRec++;
 
 		//  Create the Root Splitter
-		pSR = new Splitter<IMSR>(SRec, SKLen, Stats);
+		pSR = new Splitter<R, C>(SRec, SKLen, Stats);
 		if (pSR == nullptr) {
 			Log << "ERROR: Unable to create the root Splitter to perform the sort." << std::endl;
 			return false;
 		}
 
+		//  Establish the preemptive merge policy and the number of threads used for the final merge
+		pSR->setPMPolicy(PMP);
+		pSR->setMergeThreads(Threads);
+		pSR->setMergePathThreshold(MergePathMin);
+		if (SizedFM) pSR->enableSizedMerge();
+		if (FingerSearch) pSR->enableFingerSearch();
+
 		//
 		//  Sort Input phase - load each record to the root splitter
 		//
 
 		Stats.startInput();
 
+		//  Allocate the block for run insertion (if enabled)
+		if (RunInsert) pBlock = (R*)malloc(RUN_BLOCK * sizeof(R));
+
 		//  Process each record in turn
 		while (pNextRec < pEOI) {
 			//  Build the internal sort record
-			SRec.pRec = pNextRec;
-			SRec.pKey = pNextRec + SKOff;
-			pSR->add(SRec, PMEnabled);
+			bindRecord(SRec, pNextRec, SKOff);
+			setKeyPrefix(SRec, SKLen);
+			if (pBlock != nullptr) {
+				pBlock[BlockRecs++] = SRec;
+				if (BlockRecs == RUN_BLOCK) {
+					pSR->addBlock(pBlock, BlockRecs, PMEnabled);
+					BlockRecs = 0;
+				}
+			}
+			else pSR->add(SRec, PMEnabled);
 
 			//  Adjust the next record pointer
-			pNextRec = strchr(pNextRec, SCHAR_LF);
+			pNextRec = CPUDispatch::findLF(pNextRec);
 			if (pNextRec == nullptr) pNextRec = pEOI;
 			else pNextRec++;
 		}
 
 		//  Record the ending time
+		//  Add the final partial block and dismiss the block
+		if (pBlock != nullptr) {
+			if (BlockRecs > 0) pSR->addBlock(pBlock, BlockRecs, PMEnabled);
+			free(pBlock);
+			pBlock = nullptr;
+		}
+
 		Stats.finishInput();
 
 		//  If enabled then notify the end of the sort input phase
@@ -268,7 +622,8 @@ public:
 		//  Sort merge phase 
 		//
 
-		pSR->signalEndOfSortInput();
+		if (StreamFM) pSR->signalEndOfStreamedSortInput(Ascending);
+		else pSR->signalEndOfSortInput();
 
 		//  If enabled then notify the end of the sort merge phase
 		if (Notifications) Log << "INFO: Sort merge phase has completed." << std::endl;
@@ -280,7 +635,7 @@ public:
 		//  Check that the sort output is valid
 		if (!pSR->isOutputValid()) {
 			Log << "ERROR: The number of records in the sort is not valid, there was possibly not enough memory available to complete the sort operation." << std::endl;
-			free(pSortin);
+			freeImage(pSortin);
 			delete pSR;
 			return false;
 		}
@@ -292,18 +647,29 @@ public:
 		pSortout = (char*)malloc(SISize);
 		if (pSortout == nullptr) {
 			Log << "ERROR: Failed to allocate a buffer to hold the sort output (" << SISize << " bytes)." << std::endl;
-			free(pSortin);
+			freeImage(pSortin);
 			delete pSR;
 			return false;
 		}
 
 		//  Perform the sort output in ascending or descending sequence
 		pNextRec = pSortout;
-		if (Ascending) {
+		if (StreamFM) {
+			//  Streamed final merge, records are delivered in the requested sequence
+			for (R* pOut = pSR->nextOutput(); pOut != nullptr; pOut = pSR->nextOutput()) {
+				const char* pOutRec = recordOf(*pOut, SKOff);
+				const char* pEOR = CPUDispatch::findLF(pOutRec);
+				if (pEOR == nullptr) pEOR = pEOI;
+				size_t  RecLen = (pEOR - pOutRec) + 1;
+				memcpy(pNextRec, pOutRec, RecLen);
+				pNextRec += RecLen;
+			}
+		}
+		else if (Ascending) {
 			//  Ascending sequence
-			for (Splitter<IMSR>::Output O = pSR->lowest(); O <= pSR->highest(); O++) {
-				const char* pOutRec = (*O).pRec;
-				const char* pEOR = strchr(pOutRec, SCHAR_LF);
+			for (typename Splitter<R, C>::Output O = pSR->lowest(); O <= pSR->highest(); O++) {
+				const char* pOutRec = recordOf(*O, SKOff);
+				const char* pEOR = CPUDispatch::findLF(pOutRec);
 				if (pEOR == nullptr) pEOR = pEOI;
 				size_t  RecLen = (pEOR - pOutRec) + 1;
 				memcpy(pNextRec, pOutRec, RecLen);
@@ -312,9 +678,9 @@ public:
 		}
 		else {
 			//  Descending sequence 
-			for (Splitter<IMSR>::Output O = pSR->highest(); O >= pSR->lowest(); O--) {
-				const char* pOutRec = (*O).pRec;
-				const char* pEOR = strchr(pOutRec, SCHAR_LF);
+			for (typename Splitter<R, C>::Output O = pSR->highest(); O >= pSR->lowest(); O--) {
+				const char* pOutRec = recordOf(*O, SKOff);
+				const char* pEOR = CPUDispatch::findLF(pOutRec);
 				if (pEOR == nullptr) pEOR = pEOI;
 				size_t  RecLen = (pEOR - pOutRec) + 1;
 				memcpy(pNextRec, pOutRec, RecLen);
@@ -340,7 +706,7 @@ public:
 		Stats.finishStoring();
 
 		//  Free the input and the root splitter
-		free(pSortin);
+		freeImage(pSortin);
 		delete pSR;
 		free(pSortout);
 
@@ -383,13 +749,50 @@ public:
 		bool PMEnabled,
 		IStats& Stats) {
 
+		//  Eliminate the common sort key prefix
+		if (CommonPrefix) eliminateCommonPrefix(SFIn, MaxRecl, SKOff, SKLen);
+
+		//  Sort parameters for the engine
+		SortArgs	Args = { SFIn, SFOut, MaxRecl, SKOff, SKLen, Ascending, PMEnabled, Stats };
+
+		//  Dispatch to the engine for the selected sort record layout and key length
+		if (KeyPrefix) return dispatchKeyLength<ODSRP, OnDiskEngine>(Args);
+		if (PointerRecords || IndexRecords) return sortOnDisk<ODSRC, VarKeyCompare>(SFIn, SFOut, MaxRecl, SKOff, SKLen, Ascending, PMEnabled, Stats);
+		return dispatchKeyLength<ODSR, OnDiskEngine>(Args);
+	}
+
+	//  sortOnDisk
+	//
+	//  This function is the implementation of sortFileOnDisk() for the sort record type R and key comparator C.
+	//
+	//  PARAMETERS:
+	//
+	//		As sortFileOnDisk()
+	//
+	//  RETURNS:
+	//
+	//		bool		-		true if the sort was completed, otherwise false.
+	//
+	//  NOTES:
+	//
+
+	template <typename R, typename C>
+	bool	sortOnDisk(const char* SFIn,
+		const char* SFOut,
+		size_t MaxRecl,
+		size_t SKOff,
+		size_t SKLen,
+		bool Ascending,
+		bool PMEnabled,
+		IStats& Stats) {
+
 		std::ifstream			Sortin;																	//  Sort input stream
 		std::ofstream			Sortout;																//  Sort output stream
 		char*					SortRec = nullptr;														//  Input record buffer
-		ODSR					SRec = {};																//  Sort Record (internal)
+		R						SRec = {};																//  Sort Record (internal)
 
 		//  Root Splitter of the Splitter chain
-		Splitter<ODSR>* pSR = nullptr;
+		Splitter<R, C>* pSR = nullptr;
 
 		//
 		//  Setup ready for the input phase of the sort
@@ -429,9 +832,10 @@ public:
 		//  Build the initial SortKey record
 		SRec.RecPos = 0;
 		SRec.pKey = SortRec + SKOff;
+		setKeyPrefix(SRec, SKLen);
 
 		//  Construct the root Splitter
-		pSR = new Splitter<ODSR>(SRec, SKLen, 64, Stats);
+		pSR = new Splitter<R, C>(SRec, SKLen, 64, Stats);
 		if (pSR == nullptr) {
 			Log << "ERROR: Unable to create the root sort splitter." << std::endl;
 			free(SortRec);
@@ -439,6 +843,13 @@ public:
 			return false;
 		}
 
+		//  Establish the preemptive merge policy and the number of threads used for the final merge
+		pSR->setPMPolicy(PMP);
+		pSR->setMergeThreads(Threads);
+		pSR->setMergePathThreshold(MergePathMin);
+		if (SizedFM) pSR->enableSizedMerge();
+		if (FingerSearch) pSR->enableFingerSearch();
+
 		//
 		//  Sort input phase
 		//
@@ -449,6 +860,7 @@ public:
 			Sortin.getline(SortRec, MaxRecl);
 			if (Sortin.eof() && strlen(SortRec) == 0) break;
 			SRec.pKey = SortRec + SKOff;
+			setKeyPrefix(SRec, SKLen);
 
 			//  Add the new record to the root splitter
 			pSR->addExternalKey(SRec, PMEnabled);
@@ -463,7 +875,8 @@ public:
 		//  Sort merge phase
 		//
 
-		pSR->signalEndOfSortInput();
+		if (StreamFM) pSR->signalEndOfStreamedSortInput(Ascending);
+		else pSR->signalEndOfSortInput();
 
 		//  If enabled then notify the end of the sort merge phase
 		if (Notifications) Log << "INFO: Sort merge phase has completed." << std::endl;
@@ -496,9 +909,20 @@ public:
 
 		Stats.startOutput();
 
-		if (Ascending) {
+		if (StreamFM) {
+			//  Streamed final merge, records are delivered in the requested sequence
+			for (R* pOut = pSR->nextOutput(); pOut != nullptr; pOut = pSR->nextOutput()) {
+				//  Position sortin to the record
+				Sortin.seekg((*pOut).RecPos);
+				//  Read the record
+				Sortin.getline(SortRec, MaxRecl);
+				//  Write the record to sort output
+				Sortout << SortRec << std::endl;
+			}
+		}
+		else if (Ascending) {
 
-			for (Splitter<ODSR>::Output O = pSR->lowest(); O <= pSR->highest(); O++) {
+			for (typename Splitter<R, C>::Output O = pSR->lowest(); O <= pSR->highest(); O++) {
 				//  Position sortin to the record
 				Sortin.seekg((*O).RecPos);
 				//  Read the record
@@ -509,7 +933,7 @@ public:
 		}
 		else {
 			//  Descending sort sequence
-			for (Splitter<ODSR>::Output O = pSR->highest(); O >= pSR->lowest(); O--) {
+			for (typename Splitter<R, C>::Output O = pSR->highest(); O >= pSR->lowest(); O--) {
 				//  Position sortin to the record
 				Sortin.seekg((*O).RecPos);
 				//  Read the record
@@ -569,19 +993,61 @@ public:
 		bool Ascending,
 		bool PMEnabled,
 		IStats& Stats) {
+		size_t		SISize = 0;																		//  Sort input size (index records)
+
+		//  Eliminate the common sort key prefix, the sort input is loaded by the scan
+		if (CommonPrefix && !eliminateCommonPrefix(SFIn, SKOff, SKLen, Stats)) return false;
+
+		//  Sort parameters for the engine
+		SortArgs	Args = { SFIn, SFOut, 0, SKOff, SKLen, Ascending, PMEnabled, Stats };
+
+		//  Dispatch to the engine for the selected sort record layout and key length
+		if (KeyPrefix) return dispatchKeyLength<IMSRP, StableInMemoryEngine>(Args);
+		if (IndexRecords) SISize = getSortInputSize(SFIn);
+		if (IndexRecords && (SISize > 0) && (SISize < INDEX32_LIMIT)) return sortStableInMemory<IMSRI, VarKeyCompare>(SFIn, SFOut, SKOff, SKLen, Ascending, PMEnabled, Stats);
+		if (IndexRecords && (SISize > 0) && (SISize < INDEX40_LIMIT)) return sortStableInMemory<IMSRI5, VarKeyCompare>(SFIn, SFOut, SKOff, SKLen, Ascending, PMEnabled, Stats);
+		if (PointerRecords || IndexRecords) return sortStableInMemory<IMSRK, VarKeyCompare>(SFIn, SFOut, SKOff, SKLen, Ascending, PMEnabled, Stats);
+		return dispatchKeyLength<IMSR, StableInMemoryEngine>(Args);
+	}
+
+	//  sortStableInMemory
+	//
+	//  This function is the implementation of sortStableFileInMemory() for the sort record type R and key comparator C.
+	//
+	//  PARAMETERS:
+	//
+	//		As sortStableFileInMemory()
+	//
+	//  RETURNS:
+	//
+	//		bool		-		true if the sort was completed, otherwise false.
+	//
+	//  NOTES:
+	//
+
+	template <typename R, typename C>
+	bool	sortStableInMemory(const char* SFIn,
+		const char* SFOut,
+		size_t SKOff,
+		size_t SKLen,
+		bool Ascending,
+		bool PMEnabled,
+		IStats& Stats) {
 
 		char*					pSortin = nullptr;														//  Sort input in-memory buffer
 		char*					pSortout = nullptr;														//  Sort output in-memory buffer
 		size_t					SISize = 0;																//  Sort input size
 		char*					pEOI = nullptr;															//  Pointer to the End-Of-Input
 		char*					pNextRec = nullptr;														//  Pointer to the next record
-		IMSR					SRec = {};																//  In-Memory sort record (internal)
+		R						SRec = {};																//  In-Memory sort record (internal)
+		R*						pBlock = nullptr;														//  Block of records for run insertion
+		size_t					BlockRecs = 0;															//  Records in the block
 
 		//  Root Splitter of the Splitter chain
-		Splitter<IMSR>* pSR = nullptr;
+		Splitter<R, C>* pSR = nullptr;
 
-		//  Load the designated sort input into memory
-		Stats.startLoading();
+		//  Load the designated sort input into memory (unless already loaded by the common prefix scan)
+		if (pPreload == nullptr) Stats.startLoading();
 		pSortin = loadSortInput(SFIn, SISize);
 		if (pSortin == nullptr) {
 			Log << "ERROR: Failed to load the sort input into memory, it may be too big to sort in-memory." << std::endl;
@@ -595,42 +1061,70 @@ public:
 		pEOI = pSortin + SISize;
 		pNextRec = pSortin;																				//  Next record is the first
 
+		//  Establish the base of the sort input for index sort records
+		SRIBase::rec() = pSortin;
+		SRIBase::key() = pSortin + SKOff;
+
 		//  Setup the initial sort record
-		SRec.pRec = pNextRec;
-		SRec.pKey = pNextRec + SKOff;
+		bindRecord(SRec, pNextRec, SKOff);
+		setKeyPrefix(SRec, SKLen);
 
 		//  Adjust the next record pointer
-		pNextRec = strchr(pNextRec, SCHAR_LF);
+		pNextRec = CPUDispatch::findLF(pNextRec);
 		if (pNextRec == nullptr) pNextRec = pEOI;
 		else pNextRec++;
 
 		//  Create the Root Splitter
-		pSR = new Splitter<IMSR>(SRec, SKLen, Stats);
+		pSR = new Splitter<R, C>(SRec, SKLen, Stats);
 		if (pSR == nullptr) {
 			Log << "ERROR: Unable to create the root Splitter to perform the sort." << std::endl;
 			return false;
 		}
 
+		//  Establish the preemptive merge policy and the number of threads used for the final merge
+		pSR->setPMPolicy(PMP);
+		pSR->setMergeThreads(Threads);
+		pSR->setMergePathThreshold(MergePathMin);
+		if (SizedFM) pSR->enableSizedMerge();
+		if (FingerSearch) pSR->enableFingerSearch();
+
 		//
 		//  Sort Input phase - load each record to the root splitter
 		//
 
 		Stats.startInput();
 
+		//  Allocate the block for run insertion (if enabled)
+		if (RunInsert) pBlock = (R*)malloc(RUN_BLOCK * sizeof(R));
+
 		//  Process each record in turn
 		while (pNextRec < pEOI) {
 			//  Build the internal sort record
-			SRec.pRec = pNextRec;
-			SRec.pKey = pNextRec + SKOff;
-			pSR->addStableKey(SRec, Ascending, PMEnabled);
+			bindRecord(SRec, pNextRec, SKOff);
+			setKeyPrefix(SRec, SKLen);
+			if (pBlock != nullptr) {
+				pBlock[BlockRecs++] = SRec;
+				if (BlockRecs == RUN_BLOCK) {
+					pSR->addStableBlock(pBlock, BlockRecs, Ascending, PMEnabled);
+					BlockRecs = 0;
+				}
+			}
+			else pSR->addStableKey(SRec, Ascending, PMEnabled);
 
 			//  Adjust the next record pointer
-			pNextRec = strchr(pNextRec, SCHAR_LF);
+			pNextRec = CPUDispatch::findLF(pNextRec);
 			if (pNextRec == nullptr) pNextRec = pEOI;
 			else pNextRec++;
 		}
 
 		//  Record the ending time
+		//  Add the final partial block and dismiss the block
+		if (pBlock != nullptr) {
+			if (BlockRecs > 0) pSR->addStableBlock(pBlock, BlockRecs, Ascending, PMEnabled);
+			free(pBlock);
+			pBlock = nullptr;
+		}
+
 		Stats.finishInput();
 
 		//  If enabled then notify the end of the sort input phase
@@ -640,7 +1134,8 @@ public:
 		//  Sort final merge phase 
 		//
 
-		pSR->signalEndOfStableSortInput(Ascending);
+		if (StreamFM) pSR->signalEndOfStreamedSortInput(Ascending);
+		else pSR->signalEndOfStableSortInput(Ascending);
 
 		//  If enabled then notify the end of the sort merge phase
 		if (Notifications) Log << "INFO: Sort merge phase has completed." << std::endl;
@@ -652,7 +1147,7 @@ public:
 		//  Check that the sort output is valid
 		if (!pSR->isOutputValid()) {
 			Log << "ERROR: The number of records in the sort is not valid, there was possibly not enough memory available to complete the sort operation." << std::endl;
-			free(pSortin);
+			freeImage(pSortin);
 			delete pSR;
 			return false;
 		}
@@ -663,18 +1158,29 @@ public:
 		pSortout = (char*)malloc(SISize);
 		if (pSortout == nullptr) {
 			Log << "ERROR: Failed to allocate a buffer to hold the sort output (" << SISize << " bytes)." << std::endl;
-			free(pSortin);
+			freeImage(pSortin);
 			delete pSR;
 			return false;
 		}
 
 		//  Perform the sort output in ascending or descending sequence
 		pNextRec = pSortout;
-		if (Ascending) {
+		if (StreamFM) {
+			//  Streamed final merge, records are delivered in the requested sequence
+			for (R* pOut = pSR->nextOutput(); pOut != nullptr; pOut = pSR->nextOutput()) {
+				const char* pOutRec = recordOf(*pOut, SKOff);
+				const char* pEOR = CPUDispatch::findLF(pOutRec);
+				if (pEOR == nullptr) pEOR = pEOI;
+				size_t  RecLen = (pEOR - pOutRec) + 1;
+				memcpy(pNextRec, pOutRec, RecLen);
+				pNextRec += RecLen;
+			}
+		}
+		else if (Ascending) {
 			//  Ascending sequence
-			for (Splitter<IMSR>::Output O = pSR->lowest(); O <= pSR->highest(); O++) {
-				const char* pOutRec = (*O).pRec;
-				const char* pEOR = strchr(pOutRec, SCHAR_LF);
+			for (typename Splitter<R, C>::Output O = pSR->lowest(); O <= pSR->highest(); O++) {
+				const char* pOutRec = recordOf(*O, SKOff);
+				const char* pEOR = CPUDispatch::findLF(pOutRec);
 				if (pEOR == nullptr) pEOR = pEOI;
 				size_t  RecLen = (pEOR - pOutRec) + 1;
 				memcpy(pNextRec, pOutRec, RecLen);
@@ -683,9 +1189,9 @@ public:
 		}
 		else {
 			//  Descending sequence 
-			for (Splitter<IMSR>::Output O = pSR->highest(); O >= pSR->lowest(); O--) {
-				const char* pOutRec = (*O).pRec;
-				const char* pEOR = strchr(pOutRec, SCHAR_LF);
+			for (typename Splitter<R, C>::Output O = pSR->highest(); O >= pSR->lowest(); O--) {
+				const char* pOutRec = recordOf(*O, SKOff);
+				const char* pEOR = CPUDispatch::findLF(pOutRec);
 				if (pEOR == nullptr) pEOR = pEOI;
 				size_t  RecLen = (pEOR - pOutRec) + 1;
 				memcpy(pNextRec, pOutRec, RecLen);
@@ -710,7 +1216,7 @@ public:
 		Stats.finishStoring();
 
 		//  Free the input and the root splitter
-		free(pSortin);
+		freeImage(pSortin);
 		delete pSR;
 		free(pSortout);
 
@@ -753,28 +1259,65 @@ public:
 		bool PMEnabled,
 		IStats& Stats) {
 
-		std::ifstream			Sortin;																	//  Sort input stream
-		std::ofstream			Sortout;																//  Sort output stream
-		char*					SortRec = nullptr;														//  Input record buffer
-		ODSR					SRec = {};																//  Sort Record (internal)
-
-		//  Root Splitter of the Splitter chain
-		Splitter<ODSR>* pSR = nullptr;
-
-		//
-		//  Setup ready for the input phase of the sort
-		//
+		//  Eliminate the common sort key prefix
+		if (CommonPrefix) eliminateCommonPrefix(SFIn, MaxRecl, SKOff, SKLen);
 
-		Log << "WARNING: This sort is being performed on-disk, DO NOT use the timings for benchmarks." << std::endl;
+		//  Sort parameters for the engine
+		SortArgs	Args = { SFIn, SFOut, MaxRecl, SKOff, SKLen, Ascending, PMEnabled, Stats };
 
-		SortRec = (char*)malloc(MaxRecl);
-		if (SortRec == nullptr) {
-			Log << "ERROR: Failed to allocate a " << MaxRecl << " byte buffer for sort input records." << std::endl;
-			return false;
-		}
-		memset(SortRec, 0, MaxRecl);
+		//  Dispatch to the engine for the selected sort record layout and key length
+		if (KeyPrefix) return dispatchKeyLength<ODSRP, StableOnDiskEngine>(Args);
+		if (PointerRecords || IndexRecords) return sortStableOnDisk<ODSRC, VarKeyCompare>(SFIn, SFOut, MaxRecl, SKOff, SKLen, Ascending, PMEnabled, Stats);
+		return dispatchKeyLength<ODSR, StableOnDiskEngine>(Args);
+	}
 
-		Sortin.open(SFIn, std::istream::in);
+	//  sortStableOnDisk
+	//
+	//  This function is the implementation of sortStableFileOnDisk() for the sort record type R and key comparator C.
+	//
+	//  PARAMETERS:
+	//
+	//		As sortStableFileOnDisk()
+	//
+	//  RETURNS:
+	//
+	//		bool		-		true if the sort was completed, otherwise false.
+	//
+	//  NOTES:
+	//
+
+	template <typename R, typename C>
+	bool	sortStableOnDisk(const char* SFIn,
+		const char* SFOut,
+		size_t MaxRecl,
+		size_t SKOff,
+		size_t SKLen,
+		bool Ascending,
+		bool PMEnabled,
+		IStats& Stats) {
+
+		std::ifstream			Sortin;																	//  Sort input stream
+		std::ofstream			Sortout;																//  Sort output stream
+		char*					SortRec = nullptr;														//  Input record buffer
+		R						SRec = {};																//  Sort Record (internal)
+
+		//  Root Splitter of the Splitter chain
+		Splitter<R, C>* pSR = nullptr;
+
+		//
+		//  Setup ready for the input phase of the sort
+		//
+
+		Log << "WARNING: This sort is being performed on-disk, DO NOT use the timings for benchmarks." << std::endl;
+
+		SortRec = (char*)malloc(MaxRecl);
+		if (SortRec == nullptr) {
+			Log << "ERROR: Failed to allocate a " << MaxRecl << " byte buffer for sort input records." << std::endl;
+			return false;
+		}
+		memset(SortRec, 0, MaxRecl);
+
+		Sortin.open(SFIn, std::istream::in);
 		if (!Sortin.is_open()) {
 			Log << "ERROR: Failed to open the designated sort input file: '" << SFIn << "'." << std::endl;
 			free(SortRec);
@@ -799,9 +1342,10 @@ public:
 		//  Build the initial SortKey record
 		SRec.RecPos = 0;
 		SRec.pKey = SortRec + SKOff;
+		setKeyPrefix(SRec, SKLen);
 
 		//  Construct the root Splitter
-		pSR = new Splitter<ODSR>(SRec, SKLen, 64, Stats);
+		pSR = new Splitter<R, C>(SRec, SKLen, 64, Stats);
 		if (pSR == nullptr) {
 			Log << "ERROR: Unable to create the root sort splitter." << std::endl;
 			free(SortRec);
@@ -809,6 +1353,13 @@ public:
 			return false;
 		}
 
+		//  Establish the preemptive merge policy and the number of threads used for the final merge
+		pSR->setPMPolicy(PMP);
+		pSR->setMergeThreads(Threads);
+		pSR->setMergePathThreshold(MergePathMin);
+		if (SizedFM) pSR->enableSizedMerge();
+		if (FingerSearch) pSR->enableFingerSearch();
+
 		//
 		//  Sort input phase
 		//
@@ -819,6 +1370,7 @@ public:
 			Sortin.getline(SortRec, MaxRecl);
 			if (Sortin.eof() && strlen(SortRec) == 0) break;
 			SRec.pKey = SortRec + SKOff;
+			setKeyPrefix(SRec, SKLen);
 
 			//  Add the new record to the root splitter
 			pSR->addStableExternalKey(SRec, Ascending, PMEnabled);
@@ -833,7 +1385,8 @@ public:
 		//  Sort merge phase
 		//
 
-		pSR->signalEndOfStableSortInput(Ascending);
+		if (StreamFM) pSR->signalEndOfStreamedSortInput(Ascending);
+		else pSR->signalEndOfStableSortInput(Ascending);
 
 		//  If enabled then notify the end of the sort merge phase
 		if (Notifications) Log << "INFO: Sort merge phase has completed." << std::endl;
@@ -866,9 +1419,20 @@ public:
 
 		Stats.startOutput();
 
-		if (Ascending) {
+		if (StreamFM) {
+			//  Streamed final merge, records are delivered in the requested sequence
+			for (R* pOut = pSR->nextOutput(); pOut != nullptr; pOut = pSR->nextOutput()) {
+				//  Position sortin to the record
+				Sortin.seekg((*pOut).RecPos);
+				//  Read the record
+				Sortin.getline(SortRec, MaxRecl);
+				//  Write the record to sort output
+				Sortout << SortRec << std::endl;
+			}
+		}
+		else if (Ascending) {
 
-			for (Splitter<ODSR>::Output O = pSR->lowest(); O <= pSR->highest(); O++) {
+			for (typename Splitter<R, C>::Output O = pSR->lowest(); O <= pSR->highest(); O++) {
 				//  Position sortin to the record
 				Sortin.seekg((*O).RecPos);
 				//  Read the record
@@ -879,7 +1443,7 @@ public:
 		}
 		else {
 			//  Descending sort sequence
-			for (Splitter<ODSR>::Output O = pSR->highest(); O >= pSR->lowest(); O--) {
+			for (typename Splitter<R, C>::Output O = pSR->highest(); O >= pSR->lowest(); O--) {
 				//  Position sortin to the record
 				Sortin.seekg((*O).RecPos);
 				//  Read the record
@@ -910,136 +1474,1357 @@ public:
 		return true;
 	}
 
+	//  sortFilePartitioned
+	//
+	//  This function will sort the passed file in-memory and write the sorted output to the passed file name.
+	//  The sort input is range partitioned on the key and each partition is sorted concurrently by its own Splitter.
+	//  Sorting will conditionally use Preemptive Merging, the sort sequence is NOT stable.
+	//
+	//  PARAMETERS:
+	// 
+	//		char*		-		Const pointer to the sort input file name
+	//		char*		-		Const pointer to the sort output file
+	//		size_t		-		Offset (in records) to the sort key
+	//		size_t		-		Length of the sort key
+	//		bool		-		true if the sort sequence is ascending, false if descending
+	//		bool		-		true if Preemptive Merging is enabled, false if disabled
+	//		IStats&		-		Reference to the statistics collector/reporter object 
+	//
+	//  RETURNS:
+	// 
+	//		bool		-		true if the sort was completed, otherwise false.
+	//
+	//  NOTES:
+	//
+	//	1.	One partition is used for each thread (see setThreads()).
+	//
 
-private:
-
-	//*******************************************************************************************************************
-	//*                                                                                                                 *
-	//*   Private Members			                                                                                    *
-	//*                                                                                                                 *
-	//*******************************************************************************************************************
-
-	//  External references
-	std::ostream& Log;
-
-	//  Configuration Controls
-	bool				Notifications;										//  Notification messages enabled
-	bool				Timings;											//  Timing messages enabled
+	bool	sortFilePartitioned(const char* SFIn,
+		const char* SFOut,
+		size_t SKOff,
+		size_t SKLen,
+		bool Ascending,
+		bool PMEnabled,
+		IStats& Stats) {
 
+		//  Eliminate the common sort key prefix, the sort input is loaded by the scan
+		if (CommonPrefix && !eliminateCommonPrefix(SFIn, SKOff, SKLen, Stats)) return false;
 
-	//*******************************************************************************************************************
-	//*                                                                                                                 *
-	//*   Private Functions                                                                                             *
-	//*                                                                                                                 *
-	//*******************************************************************************************************************
+		//  Dispatch to the engine for the selected sort record layout (variable length comparator only)
+		if (KeyPrefix) return sortPartitioned<IMSRP, VarKeyCompare>(SFIn, SFOut, SKOff, SKLen, Ascending, false, PMEnabled, Stats);
+		return sortPartitioned<IMSR, VarKeyCompare>(SFIn, SFOut, SKOff, SKLen, Ascending, false, PMEnabled, Stats);
+	}
 
-	//  loadSortInput
+	//  sortStableFilePartitioned
 	//
-	//  This function will load the sort input into memory and normalise the end-of-file, any spurious empty records
-	//  will be removed from the end and the last record will be terminated with an appropriate end-line.
+	//  This function will sort the passed file in-memory and write the sorted output to the passed file name.
+	//  The sort input is range partitioned on the key and each partition is sorted concurrently by its own Splitter.
+	//  Sorting will conditionally use Preemptive Merging, the sort sequence is stable.
 	//
 	//  PARAMETERS:
 	// 
 	//		char*		-		Const pointer to the sort input file name
-	//		size_t&		-		Reference to the variable to hold the size of the loaded file
+	//		char*		-		Const pointer to the sort output file
+	//		size_t		-		Offset (in records) to the sort key
+	//		size_t		-		Length of the sort key
+	//		bool		-		true if the sort sequence is ascending, false if descending
+	//		bool		-		true if Preemptive Merging is enabled, false if disabled
+	//		IStats&		-		Reference to the statistics collector/reporter object 
 	//
 	//  RETURNS:
 	// 
-	//		char*		-		Pointer to the allocated buffer holding the file contents
+	//		bool		-		true if the sort was completed, otherwise false.
 	//
 	//  NOTES:
-	// 
-	//		The sortin file MUST be pre-checked for validity
-	//		Any problems encountered will result in a nullptr being returned and the size reported as zero
+	//
+	//	1.	One partition is used for each thread (see setThreads()).
+	//	2.	Identical keys are always placed in the same partition in input sequence, so the sequence is preserved.
 	//
 
-	char* loadSortInput(const char* szSortin, size_t& SILen) {
-		FILE*		pRFile = nullptr;																					//  Handle of the sortin file
-		errno_t		Result = 0;																							//  Return from fopen_s()
-		size_t		FSize = 0;																							//  File size
-		size_t		ElementsRead = 0;																					//  Number of alements read
-		char*		pFImg = nullptr;																					//  Sort input image
-		size_t		FixLen = 0;																							//  Fixed length of the file content
-		bool		B2IRS = false;																						//  2 byte IRS (cr/lf) in use
-		char*		pIRS = nullptr;																						//  Pointer to an IRS
+	bool	sortStableFilePartitioned(const char* SFIn,
+		const char* SFOut,
+		size_t SKOff,
+		size_t SKLen,
+		bool Ascending,
+		bool PMEnabled,
+		IStats& Stats) {
 
-		//  Safety
-		SILen = 0;
+		//  Eliminate the common sort key prefix, the sort input is loaded by the scan
+		if (CommonPrefix && !eliminateCommonPrefix(SFIn, SKOff, SKLen, Stats)) return false;
 
-		//  Open the file
-		Result = fopen_s(&pRFile, szSortin, "rb");
-		if (Result != 0 || pRFile == nullptr) {
-			Log << "ERROR: Unable to open file: '" << szSortin << "' - Open RC: " << Result << "." << std::endl;
-			return nullptr;
+		//  Dispatch to the engine for the selected sort record layout (variable length comparator only)
+		if (KeyPrefix) return sortPartitioned<IMSRP, VarKeyCompare>(SFIn, SFOut, SKOff, SKLen, Ascending, true, PMEnabled, Stats);
+		return sortPartitioned<IMSR, VarKeyCompare>(SFIn, SFOut, SKOff, SKLen, Ascending, true, PMEnabled, Stats);
+	}
+
+	//  sortPartitioned
+	//
+	//  This function is the implementation of sortFilePartitioned() and sortStableFilePartitioned() for the sort record
+	//  type R and key comparator C.
+	//
+	//  PARAMETERS:
+	//
+	//		As sortFilePartitioned() with the addition of
+	//		bool		-		true if the sort sequence is stable, otherwise false
+	//
+	//  RETURNS:
+	//
+	//		bool		-		true if the sort was completed, otherwise false.
+	//
+	//  NOTES:
+	//
+	//	1.	The partition splitter keys are chosen from a regular sample of the input that is itself sorted by a Splitter.
+	//	2.	A record is placed in the first partition whose splitter key is above the record key, all of the records
+	//		with identical keys are therefore in the same partition.
+	//	3.	The partitions are collated in key sequence, so no merge is needed between the partitions.
+	//
+
+	template <typename R, typename C>
+	bool	sortPartitioned(const char* SFIn,
+		const char* SFOut,
+		size_t SKOff,
+		size_t SKLen,
+		bool Ascending,
+		bool Stable,
+		bool PMEnabled,
+		IStats& Stats) {
+
+		char*					pSortin = nullptr;														//  Sort input in-memory buffer
+		char*					pSortout = nullptr;														//  Sort output in-memory buffer
+		size_t					SISize = 0;																//  Sort input size
+		char*					pEOI = nullptr;															//  Pointer to the End-Of-Input
+		char*					pNextRec = nullptr;														//  Pointer to the next record
+		size_t					Records = 0;															//  Number of records in the input
+		size_t					Parts = 1;																//  Number of partitions
+		size_t					Stores = 0;																//  Stores in all partitions at the final merge
+		R*						pRecs = nullptr;														//  Sort records in input sequence
+		R*						pPartRecs = nullptr;													//  Sort records in partition sequence
+		uint32_t*				pRecLen = nullptr;														//  Length of each input record
+		uint16_t*				pPartNo = nullptr;														//  Partition of each input record
+		R*						pSplitKeys = nullptr;													//  Partition splitter keys
+		size_t*					pPartStart = nullptr;													//  First record of each partition
+		size_t*					pPartCount = nullptr;													//  Records in each partition
+		size_t*					pPartOut = nullptr;														//  Output offset of each partition
+		Splitter<R, C>**		pPartSR = nullptr;														//  Splitter for each partition
+		IStats*					pPartStats = nullptr;													//  Statistics for each partition
+		WorkerPool				Pool(Threads);															//  Worker pool for the partitions
+
+		//  Load the designated sort input into memory (unless already loaded by the common prefix scan)
+		if (pPreload == nullptr) Stats.startLoading();
+		pSortin = loadSortInput(SFIn, SISize);
+		if (pSortin == nullptr) {
+			Log << "ERROR: Failed to load the sort input into memory, it may be too big to sort in-memory." << std::endl;
+			return false;
 		}
+		Stats.finishLoading();
 
-		//  Determine the file size
-		fseek(pRFile, 0, SEEK_END);
-		FSize = ftell(pRFile);
-		rewind(pRFile);
+		//  The sort timing starts once the data has been loaded
+		Stats.startSorting();
+		Stats.startInput();
+		pEOI = pSortin + SISize;
 
-		//  Allocate a buffer to hold the file contents
-		//  3 additional bytes are allocated one for EOS (\0) and two for a possible cr/lf insert
-		pFImg = (char*)malloc(FSize + 3);
-		if (pFImg == nullptr) {
-			fclose(pRFile);
-			Log << "ERROR: Failed to allocate: " << FSize << " bytes to hold the sort input." << std::endl;
-			return nullptr;
+		//  Count the records in the input
+		for (pNextRec = pSortin; pNextRec < pEOI; Records++) {
+			pNextRec = CPUDispatch::findLF(pNextRec);
+			if (pNextRec == nullptr) pNextRec = pEOI;
+			else pNextRec++;
+		}
+		if (Records == 0) {
+			Log << "ERROR: The sort input does not contain any records." << std::endl;
+			freeImage(pSortin);
+			return false;
 		}
 
-		//  Read the content of the file into memory
-		ElementsRead = fread(pFImg, 1, FSize, pRFile);
-		fclose(pRFile);
-		if (ElementsRead != FSize) {
-			Log << "ERROR: Failed to load: " << FSize << " bytes of sort input into memory." << std::endl;
-			free(pFImg);
-			return nullptr;
+		//  Determine the number of partitions
+		Parts = Pool.getThreads();
+		if (Parts > Records) Parts = Records;
+		if (Parts > 65535) Parts = 65535;
+
+		//  Allocate the partitioning structures
+		pRecs = (R*)malloc(Records * sizeof(R));
+		pPartRecs = (R*)malloc(Records * sizeof(R));
+		pRecLen = (uint32_t*)malloc(Records * sizeof(uint32_t));
+		pPartNo = (uint16_t*)malloc(Records * sizeof(uint16_t));
+		pSplitKeys = (R*)malloc(Parts * sizeof(R));
+		pPartStart = (size_t*)calloc(Parts, sizeof(size_t));
+		pPartCount = (size_t*)calloc(Parts, sizeof(size_t));
+		pPartOut = (size_t*)calloc(Parts, sizeof(size_t));
+		pPartSR = (Splitter<R, C>**)calloc(Parts, sizeof(Splitter<R, C>*));
+		pPartStats = new IStats[Parts];
+		if (pRecs == nullptr || pPartRecs == nullptr || pRecLen == nullptr || pPartNo == nullptr || pSplitKeys == nullptr ||
+			pPartStart == nullptr || pPartCount == nullptr || pPartOut == nullptr || pPartSR == nullptr) {
+			Log << "ERROR: Failed to allocate the structures to partition: " << Records << " records." << std::endl;
+			freeImage(pSortin);
+			if (pRecs != nullptr) free(pRecs);
+			if (pPartRecs != nullptr) free(pPartRecs);
+			if (pRecLen != nullptr) free(pRecLen);
+			if (pPartNo != nullptr) free(pPartNo);
+			if (pSplitKeys != nullptr) free(pSplitKeys);
+			if (pPartStart != nullptr) free(pPartStart);
+			if (pPartCount != nullptr) free(pPartCount);
+			if (pPartOut != nullptr) free(pPartOut);
+			if (pPartSR != nullptr) free(pPartSR);
+			delete[] pPartStats;
+			return false;
 		}
 
-		//  Make the image a well-formed string
-		pFImg[ElementsRead] = '\0';
+		//  Build the sort records in input sequence
+		pNextRec = pSortin;
+		for (size_t rIndex = 0; rIndex < Records; rIndex++) {
+			char*	pRecStart = pNextRec;
+			pRecs[rIndex] = {};
+			pRecs[rIndex].pRec = pNextRec;
+			pRecs[rIndex].pKey = pNextRec + SKOff;
+			setKeyPrefix(pRecs[rIndex], SKLen);
+			pNextRec = CPUDispatch::findLF(pNextRec);
+			if (pNextRec == nullptr) pNextRec = pEOI;
+			else pNextRec++;
+			pRecLen[rIndex] = uint32_t(pNextRec - pRecStart);
+		}
 
-		//  Determine the IRS in use
-		FixLen = FSize;
-		pIRS = strchr(pFImg, SCHAR_LF);
-		if (pIRS == nullptr) {
-			SILen = FixLen;
-			return pFImg;
+		//  Choose the partition splitter keys
+		selectSplitKeys<R, C>(pRecs, Records, SKLen, pSplitKeys, Parts);
+
+		//  Assign each record to a partition and count the records and bytes in each partition
+		for (size_t rIndex = 0; rIndex < Records; rIndex++) {
+			size_t		Lo = 0;
+			size_t		Hi = Parts - 1;
+			while (Lo < Hi) {
+				size_t	Mid = (Lo + Hi) / 2;
+				if (compareKeys<C>(pRecs[rIndex], pSplitKeys[Mid], SKLen) < 0) Hi = Mid;
+				else Lo = Mid + 1;
+			}
+			pPartNo[rIndex] = uint16_t(Lo);
+			pPartCount[Lo]++;
+			pPartOut[Lo] += pRecLen[rIndex];
 		}
-		if (pIRS == pFImg) {
-			SILen = FixLen;
-			return pFImg;
+
+		//  Compute the start of each partition and the output offset of each partition
+		{
+			size_t		NextStart = 0;
+			size_t		NextOut = 0;
+			for (size_t pIndex = 0; pIndex < Parts; pIndex++) {
+				size_t	OutPart = Ascending ? pIndex : (Parts - 1) - pIndex;
+				size_t	PartBytes = pPartOut[OutPart];
+				pPartStart[pIndex] = NextStart;
+				NextStart += pPartCount[pIndex];
+				pPartOut[OutPart] = NextOut;
+				NextOut += PartBytes;
+			}
 		}
-		pIRS--;
-		if (*pIRS == SCHAR_CR) B2IRS = true;
 
-		//  Remove any cr/lf bytes from the end of the file
-		pIRS = pFImg + (FixLen - 1);
-		while ((*pIRS == SCHAR_CR || *pIRS == SCHAR_LF) && pIRS > pFImg) {
-			*pIRS = '\0';
-			FixLen--;
-			pIRS--;
+		//  Scatter the records into the partitions preserving the input sequence
+		{
+			size_t*		pNext = (size_t*)malloc(Parts * sizeof(size_t));
+			if (pNext == nullptr) {
+				std::cerr << "FATAL: Failed to allocate the partition cursors." << std::endl;
+				std::abort();
+			}
+			memcpy(pNext, pPartStart, Parts * sizeof(size_t));
+			for (size_t rIndex = 0; rIndex < Records; rIndex++) pPartRecs[pNext[pPartNo[rIndex]]++] = pRecs[rIndex];
+			free(pNext);
 		}
-		pIRS++;
+		free(pRecs);
+		pRecs = nullptr;
+		free(pPartNo);
+		pPartNo = nullptr;
+		free(pRecLen);
+		pRecLen = nullptr;
 
-		//  Add a new IRS onto the old record
-		if (B2IRS) {
-			*pIRS = SCHAR_CR;
-			FixLen++;
-			pIRS++;
-			*pIRS = SCHAR_LF;
-			FixLen++;
+		//
+		//  Sort Input phase - load each partition into its own splitter concurrently
+		//
+
+		Pool.dispatch(Parts, [&](size_t Part) {
+			R*		pPR = pPartRecs + pPartStart[Part];
+			size_t	PartRecs = pPartCount[Part];
+
+			if (PartRecs == 0) return;
+			pPartSR[Part] = new Splitter<R, C>(pPR[0], SKLen, pPartStats[Part]);
+			pPartSR[Part]->setPMPolicy(PMP);
+			if (SizedFM) pPartSR[Part]->enableSizedMerge();
+			if (FingerSearch) pPartSR[Part]->enableFingerSearch();
+			if (RunInsert) {
+				if (Stable) pPartSR[Part]->addStableBlock(pPR + 1, PartRecs - 1, Ascending, PMEnabled);
+				else pPartSR[Part]->addBlock(pPR + 1, PartRecs - 1, PMEnabled);
+			}
+			else {
+				for (size_t rIndex = 1; rIndex < PartRecs; rIndex++) {
+					if (Stable) pPartSR[Part]->addStableKey(pPR[rIndex], Ascending, PMEnabled);
+					else pPartSR[Part]->add(pPR[rIndex], PMEnabled);
+				}
+			}
+		});
+
+		//  Record the ending time
+		Stats.finishInput();
+
+		//  If enabled then notify the end of the sort input phase
+		if (Notifications) Log << "INFO: Sort input phase has completed (" << Parts << " partitions)." << std::endl;
+
+		//
+		//  Sort merge phase - each partition is merged concurrently
+		//
+
+		Stats.startFM();
+		Pool.dispatch(Parts, [&](size_t Part) {
+			if (pPartSR[Part] == nullptr) return;
+			if (StreamFM) pPartSR[Part]->signalEndOfStreamedSortInput(Ascending);
+			else if (Stable) pPartSR[Part]->signalEndOfStableSortInput(Ascending);
+			else pPartSR[Part]->signalEndOfSortInput();
+		});
+		for (size_t pIndex = 0; pIndex < Parts; pIndex++) {
+			Stores += pPartStats[pIndex].FMStoresMerged;
 		}
-		else {
-			*pIRS = SCHAR_LF;
-			FixLen++;
+		Stats.finishFM(Stores);
+		for (size_t pIndex = 0; pIndex < Parts; pIndex++) Stats.accumulate(pPartStats[pIndex]);
+
+		//  If enabled then notify the end of the sort merge phase
+		if (Notifications) Log << "INFO: Sort merge phase has completed." << std::endl;
+
+		//
+		//  Sort output phase
+		//
+
+		//  Check that the sort output is valid
+		{
+			bool	Valid = true;
+			for (size_t pIndex = 0; pIndex < Parts; pIndex++) {
+				if (pPartSR[pIndex] != nullptr && !pPartSR[pIndex]->isOutputValid()) Valid = false;
+			}
+			if (!Valid) {
+				Log << "ERROR: The number of records in the sort is not valid, there was possibly not enough memory available to complete the sort operation." << std::endl;
+				freePartitions<R, C>(pPartSR, Parts);
+				freeImage(pSortin);
+				free(pPartRecs);
+				free(pPartStart);
+				free(pPartCount);
+				free(pPartOut);
+				free(pSplitKeys);
+				delete[] pPartStats;
+				return false;
+			}
 		}
 
-		//  Return the loaded, normalised image
-		SILen = FixLen;
+		//  Record starting time for the output preparation
+		Stats.startOutput();
+
+		//  Allocate a buffer to hold the sort output
+		pSortout = (char*)malloc(SISize);
+		if (pSortout == nullptr) {
+			Log << "ERROR: Failed to allocate a buffer to hold the sort output (" << SISize << " bytes)." << std::endl;
+			freePartitions<R, C>(pPartSR, Parts);
+			freeImage(pSortin);
+			free(pPartRecs);
+			free(pPartStart);
+			free(pPartCount);
+			free(pPartOut);
+			free(pSplitKeys);
+			delete[] pPartStats;
+			return false;
+		}
+
+		//  Each partition is written concurrently into its own region of the output in ascending or descending sequence
+		Pool.dispatch(Parts, [&](size_t Part) {
+			Splitter<R, C>* pPSR = pPartSR[Part];
+			char*			pOutNext = pSortout + pPartOut[Part];
+
+			if (pPSR == nullptr) return;
+			if (StreamFM) {
+				for (R* pOut = pPSR->nextOutput(); pOut != nullptr; pOut = pPSR->nextOutput()) {
+					pOutNext = copyRecord((*pOut).pRec, pEOI, pOutNext);
+				}
+			}
+			else if (Ascending) {
+				for (typename Splitter<R, C>::Output O = pPSR->lowest(); O <= pPSR->highest(); O++) pOutNext = copyRecord((*O).pRec, pEOI, pOutNext);
+			}
+			else {
+				for (typename Splitter<R, C>::Output O = pPSR->highest(); O >= pPSR->lowest(); O--) pOutNext = copyRecord((*O).pRec, pEOI, pOutNext);
+			}
+		});
+
+		//  The sort ending time is taken at this point
+		Stats.finishOutput();
+		Stats.finishSorting();
+
+		//  Notify end of phase
+		if (Notifications) Log << "INFO: Sort output phase completed." << std::endl;
+
+		//  Free the partitions
+		freePartitions<R, C>(pPartSR, Parts);
+		free(pPartRecs);
+		free(pPartStart);
+		free(pPartCount);
+		free(pPartOut);
+		free(pSplitKeys);
+		delete[] pPartStats;
+
+		//  Write the sortout buffer to disk
+		Stats.startStoring();
+		if (!storeSortOutput(SFOut, pSortout, SISize)) {
+			Log << "ERROR: Failed to store: " << SISize << "bytes of sort output data." << std::endl;
+			freeImage(pSortin);
+			free(pSortout);
+			return false;
+		}
+		Stats.finishStoring();
+
+		//  Free the input and output
+		freeImage(pSortin);
+		free(pSortout);
+
+		//  If enabled show the timings
+		if (Timings) Stats.showStats(Log);
+
+		//  Return showing success
+		return true;
+	}
+
+	//  sortFileChunked
+	//
+	//  This function will sort the passed file in-memory and write the sorted output to the passed file name.
+	//  The sort input is split into contiguous chunks and each chunk is sorted concurrently by its own Splitter.
+	//  Sorting will conditionally use Preemptive Merging, the sort sequence is NOT stable.
+	//
+	//  PARAMETERS:
+	// 
+	//		char*		-		Const pointer to the sort input file name
+	//		char*		-		Const pointer to the sort output file
+	//		size_t		-		Offset (in records) to the sort key
+	//		size_t		-		Length of the sort key
+	//		bool		-		true if the sort sequence is ascending, false if descending
+	//		bool		-		true if Preemptive Merging is enabled, false if disabled
+	//		IStats&		-		Reference to the statistics collector/reporter object 
+	//
+	//  RETURNS:
+	// 
+	//		bool		-		true if the sort was completed, otherwise false.
+	//
+	//  NOTES:
+	//
+	//	1.	One chunk is used for each thread (see setThreads()).
+	//
+
+	bool	sortFileChunked(const char* SFIn,
+		const char* SFOut,
+		size_t SKOff,
+		size_t SKLen,
+		bool Ascending,
+		bool PMEnabled,
+		IStats& Stats) {
+
+		//  Eliminate the common sort key prefix, the sort input is loaded by the scan
+		if (CommonPrefix && !eliminateCommonPrefix(SFIn, SKOff, SKLen, Stats)) return false;
+
+		//  Dispatch to the engine for the selected sort record layout (variable length comparator only)
+		if (KeyPrefix) return sortChunked<IMSRP, VarKeyCompare>(SFIn, SFOut, SKOff, SKLen, Ascending, false, PMEnabled, Stats);
+		return sortChunked<IMSR, VarKeyCompare>(SFIn, SFOut, SKOff, SKLen, Ascending, false, PMEnabled, Stats);
+	}
+
+	//  sortStableFileChunked
+	//
+	//  This function will sort the passed file in-memory and write the sorted output to the passed file name.
+	//  The sort input is split into contiguous chunks and each chunk is sorted concurrently by its own Splitter.
+	//  Sorting will conditionally use Preemptive Merging, the sort sequence is stable.
+	//
+	//  PARAMETERS:
+	// 
+	//		char*		-		Const pointer to the sort input file name
+	//		char*		-		Const pointer to the sort output file
+	//		size_t		-		Offset (in records) to the sort key
+	//		size_t		-		Length of the sort key
+	//		bool		-		true if the sort sequence is ascending, false if descending
+	//		bool		-		true if Preemptive Merging is enabled, false if disabled
+	//		IStats&		-		Reference to the statistics collector/reporter object 
+	//
+	//  RETURNS:
+	// 
+	//		bool		-		true if the sort was completed, otherwise false.
+	//
+	//  NOTES:
+	//
+	//	1.	One chunk is used for each thread (see setThreads()).
+	//	2.	The stores of the chunks are merged in input sequence, so the sequence of identical keys is preserved.
+	//
+
+	bool	sortStableFileChunked(const char* SFIn,
+		const char* SFOut,
+		size_t SKOff,
+		size_t SKLen,
+		bool Ascending,
+		bool PMEnabled,
+		IStats& Stats) {
+
+		//  Eliminate the common sort key prefix, the sort input is loaded by the scan
+		if (CommonPrefix && !eliminateCommonPrefix(SFIn, SKOff, SKLen, Stats)) return false;
+
+		//  Dispatch to the engine for the selected sort record layout (variable length comparator only)
+		if (KeyPrefix) return sortChunked<IMSRP, VarKeyCompare>(SFIn, SFOut, SKOff, SKLen, Ascending, true, PMEnabled, Stats);
+		return sortChunked<IMSR, VarKeyCompare>(SFIn, SFOut, SKOff, SKLen, Ascending, true, PMEnabled, Stats);
+	}
+
+	//  sortChunked
+	//
+	//  This function is the implementation of sortFileChunked() and sortStableFileChunked() for the sort record
+	//  type R and key comparator C.
+	//
+	//  PARAMETERS:
+	//
+	//		As sortFileChunked() with the addition of
+	//		bool		-		true if the sort sequence is stable, otherwise false
+	//
+	//  RETURNS:
+	//
+	//		bool		-		true if the sort was completed, otherwise false.
+	//
+	//  NOTES:
+	//
+	//	1.	The sort input buffer is split into equal sized chunks on record boundaries, each chunk keeps the input
+	//		locality (runs and pile ups) that the Splitter exploits.
+	//	2.	Once the input is complete the stores of every chunk are adopted, in chunk sequence, by the Splitter of the
+	//		first chunk and a single (multi-threaded) final merge is performed over all of the stores.
+	//
+
+	template <typename R, typename C>
+	bool	sortChunked(const char* SFIn,
+		const char* SFOut,
+		size_t SKOff,
+		size_t SKLen,
+		bool Ascending,
+		bool Stable,
+		bool PMEnabled,
+		IStats& Stats) {
+
+		char*					pSortin = nullptr;														//  Sort input in-memory buffer
+		char*					pSortout = nullptr;														//  Sort output in-memory buffer
+		size_t					SISize = 0;																//  Sort input size
+		char*					pEOI = nullptr;															//  Pointer to the End-Of-Input
+		char*					pNextRec = nullptr;														//  Pointer to the next record
+		size_t					Chunks = 1;																//  Number of chunks
+		size_t					Root = 0;																//  Chunk that performs the final merge
+		char**					pChunk = nullptr;														//  Start of each chunk (+ End-Of-Input)
+		Splitter<R, C>**		pChunkSR = nullptr;														//  Splitter for each chunk
+		IStats*					pChunkStats = nullptr;													//  Statistics for each chunk
+		Splitter<R, C>*			pSR = nullptr;															//  Splitter for the final merge
+		WorkerPool				Pool(Threads);															//  Worker pool for the chunks
+
+		//  Load the designated sort input into memory (unless already loaded by the common prefix scan)
+		if (pPreload == nullptr) Stats.startLoading();
+		pSortin = loadSortInput(SFIn, SISize);
+		if (pSortin == nullptr) {
+			Log << "ERROR: Failed to load the sort input into memory, it may be too big to sort in-memory." << std::endl;
+			return false;
+		}
+		Stats.finishLoading();
+
+		//  The sort timing starts once the data has been loaded
+		Stats.startSorting();
+		Stats.startInput();
+		pEOI = pSortin + SISize;
+
+		//  Allocate the chunk structures
+		Chunks = Pool.getThreads();
+		pChunk = (char**)malloc((Chunks + 1) * sizeof(char*));
+		pChunkSR = (Splitter<R, C>**)calloc(Chunks, sizeof(Splitter<R, C>*));
+		pChunkStats = new IStats[Chunks];
+		if (pChunk == nullptr || pChunkSR == nullptr) {
+			Log << "ERROR: Failed to allocate the structures to sort: " << Chunks << " chunks." << std::endl;
+			freeImage(pSortin);
+			if (pChunk != nullptr) free(pChunk);
+			if (pChunkSR != nullptr) free(pChunkSR);
+			delete[] pChunkStats;
+			return false;
+		}
+
+		//  Split the input into chunks of (roughly) equal size, each chunk starts on a record boundary
+		pChunk[0] = pSortin;
+		for (size_t cIndex = 1; cIndex < Chunks; cIndex++) {
+			pNextRec = pSortin + ((SISize / Chunks) * cIndex);
+			if (pNextRec < pChunk[cIndex - 1]) pNextRec = pChunk[cIndex - 1];
+			if (pNextRec > pSortin && pNextRec < pEOI && *(pNextRec - 1) != SCHAR_LF) {
+				pNextRec = CPUDispatch::findLF(pNextRec);
+				if (pNextRec == nullptr) pNextRec = pEOI;
+				else pNextRec++;
+			}
+			pChunk[cIndex] = pNextRec;
+		}
+		pChunk[Chunks] = pEOI;
+
+		//
+		//  Sort Input phase - load each chunk into its own splitter concurrently
+		//
+
+		Pool.dispatch(Chunks, [&](size_t Chunk) {
+			char*	pCR = pChunk[Chunk];
+			char*	pEOC = pChunk[Chunk + 1];
+			R		SRec = {};
+			R*		pBlock = nullptr;
+			size_t	BlockRecs = 0;
+
+			if (pCR >= pEOC) return;
+
+			//  The first record of the chunk initialises the splitter
+			SRec.pRec = pCR;
+			SRec.pKey = pCR + SKOff;
+			setKeyPrefix(SRec, SKLen);
+			pCR = CPUDispatch::findLF(pCR);
+			if (pCR == nullptr) pCR = pEOI;
+			else pCR++;
+			pChunkSR[Chunk] = new Splitter<R, C>(SRec, SKLen, pChunkStats[Chunk]);
+			pChunkSR[Chunk]->setPMPolicy(PMP);
+			if (FingerSearch) pChunkSR[Chunk]->enableFingerSearch();
+
+			//  Process each record in turn
+			if (RunInsert) pBlock = (R*)malloc(RUN_BLOCK * sizeof(R));
+			while (pCR < pEOC) {
+				SRec.pRec = pCR;
+				SRec.pKey = pCR + SKOff;
+				setKeyPrefix(SRec, SKLen);
+				if (pBlock != nullptr) {
+					pBlock[BlockRecs++] = SRec;
+					if (BlockRecs == RUN_BLOCK) {
+						if (Stable) pChunkSR[Chunk]->addStableBlock(pBlock, BlockRecs, Ascending, PMEnabled);
+						else pChunkSR[Chunk]->addBlock(pBlock, BlockRecs, PMEnabled);
+						BlockRecs = 0;
+					}
+				}
+				else if (Stable) pChunkSR[Chunk]->addStableKey(SRec, Ascending, PMEnabled);
+				else pChunkSR[Chunk]->add(SRec, PMEnabled);
+
+				pCR = CPUDispatch::findLF(pCR);
+				if (pCR == nullptr) pCR = pEOI;
+				else pCR++;
+			}
+
+			//  Add the final partial block and dismiss the block
+			if (pBlock != nullptr) {
+				if (BlockRecs > 0) {
+					if (Stable) pChunkSR[Chunk]->addStableBlock(pBlock, BlockRecs, Ascending, PMEnabled);
+					else pChunkSR[Chunk]->addBlock(pBlock, BlockRecs, PMEnabled);
+				}
+				free(pBlock);
+			}
+		});
+
+		//  The first chunk adopts the stores of the following chunks in input sequence
+		while (Root < Chunks && pChunkSR[Root] == nullptr) Root++;
+		if (Root == Chunks) {
+			Log << "ERROR: The sort input does not contain any records." << std::endl;
+			freeImage(pSortin);
+			free(pChunk);
+			free(pChunkSR);
+			delete[] pChunkStats;
+			return false;
+		}
+		pSR = pChunkSR[Root];
+		for (size_t cIndex = Root + 1; cIndex < Chunks; cIndex++) {
+			if (pChunkSR[cIndex] == nullptr) continue;
+			pSR->adoptStores(*pChunkSR[cIndex]);
+			delete pChunkSR[cIndex];
+			pChunkSR[cIndex] = nullptr;
+		}
+
+		//  Record the ending time
+		Stats.finishInput();
+
+		//  If enabled then notify the end of the sort input phase
+		if (Notifications) Log << "INFO: Sort input phase has completed (" << Chunks << " chunks)." << std::endl;
+
+		//
+		//  Sort merge phase - a single final merge over the stores of every chunk
+		//
+
+		pSR->setMergeThreads(Threads);
+		pSR->setMergePathThreshold(MergePathMin);
+		if (SizedFM) pSR->enableSizedMerge();
+		Stats.startFM();
+		if (StreamFM) pSR->signalEndOfStreamedSortInput(Ascending);
+		else if (Stable) pSR->signalEndOfStableSortInput(Ascending);
+		else pSR->signalEndOfSortInput();
+		Stats.finishFM(pChunkStats[Root].FMStoresMerged);
+		for (size_t cIndex = 0; cIndex < Chunks; cIndex++) Stats.accumulate(pChunkStats[cIndex]);
+
+		//  If enabled then notify the end of the sort merge phase
+		if (Notifications) Log << "INFO: Sort merge phase has completed." << std::endl;
+
+		//
+		//  Sort output phase
+		//
+
+		//  Check that the sort output is valid
+		if (!pSR->isOutputValid()) {
+			Log << "ERROR: The number of records in the sort is not valid, there was possibly not enough memory available to complete the sort operation." << std::endl;
+			freeImage(pSortin);
+			delete pSR;
+			free(pChunk);
+			free(pChunkSR);
+			delete[] pChunkStats;
+			return false;
+		}
+
+		//  Record starting time for the output preparation
+		Stats.startOutput();
+
+		//  Allocate a buffer to hold the sort output
+		pSortout = (char*)malloc(SISize);
+		if (pSortout == nullptr) {
+			Log << "ERROR: Failed to allocate a buffer to hold the sort output (" << SISize << " bytes)." << std::endl;
+			freeImage(pSortin);
+			delete pSR;
+			free(pChunk);
+			free(pChunkSR);
+			delete[] pChunkStats;
+			return false;
+		}
+
+		//  Perform the sort output in ascending or descending sequence
+		pNextRec = pSortout;
+		if (StreamFM) {
+			for (R* pOut = pSR->nextOutput(); pOut != nullptr; pOut = pSR->nextOutput()) pNextRec = copyRecord((*pOut).pRec, pEOI, pNextRec);
+		}
+		else if (Ascending) {
+			for (typename Splitter<R, C>::Output O = pSR->lowest(); O <= pSR->highest(); O++) pNextRec = copyRecord((*O).pRec, pEOI, pNextRec);
+		}
+		else {
+			for (typename Splitter<R, C>::Output O = pSR->highest(); O >= pSR->lowest(); O--) pNextRec = copyRecord((*O).pRec, pEOI, pNextRec);
+		}
+
+		//  The sort ending time is taken at this point
+		Stats.finishOutput();
+		Stats.finishSorting();
+
+		//  Notify end of phase
+		if (Notifications) Log << "INFO: Sort output phase completed." << std::endl;
+
+		//  Dismiss the splitter (the adopted stores are held with the chunk statistics)
+		delete pSR;
+		free(pChunk);
+		free(pChunkSR);
+		delete[] pChunkStats;
+
+		//  Write the sortout buffer to disk
+		Stats.startStoring();
+		if (!storeSortOutput(SFOut, pSortout, SISize)) {
+			Log << "ERROR: Failed to store: " << SISize << "bytes of sort output data." << std::endl;
+			freeImage(pSortin);
+			free(pSortout);
+			return false;
+		}
+		Stats.finishStoring();
+
+		//  Free the input and output
+		freeImage(pSortin);
+		free(pSortout);
+
+		//  If enabled show the timings
+		if (Timings) Stats.showStats(Log);
+
+		//  Return showing success
+		return true;
+	}
+
+
+private:
+
+	//*******************************************************************************************************************
+	//*                                                                                                                 *
+	//*   Private Members			                                                                                    *
+	//*                                                                                                                 *
+	//*******************************************************************************************************************
+
+	//  External references
+	std::ostream& Log;
+
+	//  Configuration Controls
+	bool				Notifications;										//  Notification messages enabled
+	bool				Timings;											//  Timing messages enabled
+	size_t				Threads;											//  Number of threads for parallel phases
+	size_t				MergePathMin;										//  Minimum records for a partitioned merge
+	bool				StreamFM;											//  Final merge is streamed into the output phase
+	bool				SizedFM;											//  Final merge pairs are scheduled by size
+	bool				KeyPrefix;											//  Sort records hold an inline key prefix
+	bool				RunInsert;											//  In-memory input is added in blocks with run detection
+	bool				FingerSearch;										//  Store chain is searched from the previous key's store
+	bool				PointerRecords;										//  In-memory records hold only a key pointer
+	bool				IndexRecords;										//  In-memory records hold only a record offset
+	bool				CommonPrefix;										//  Common sort key prefix is eliminated
+	char*				pPreload;											//  Sort input image loaded by the common prefix scan
+	size_t				PreloadSize;										//  Size of the preloaded sort input image
+	PMPolicy			PMP;												//  Preemptive merge policy
+
+
+	//*******************************************************************************************************************
+	//*                                                                                                                 *
+	//*   Private Functions                                                                                             *
+	//*                                                                                                                 *
+	//*******************************************************************************************************************
+
+	//  dispatchKeyLength
+	//
+	//  This function will run the engine E for the sort record type R with the key comparator selected by the length
+	//  of the sort key.
+	//
+	//  PARAMETERS:
+	//
+	//		SortArgs&	-		Const reference to the parameters of the sort
+	//
+	//  RETURNS:
+	//
+	//		bool		-		true if the sort was completed, otherwise false.
+	//
+	//  NOTES:
+	//
+	//	1.	Key lengths without a fixed length comparator use the variable length comparator.
+	//	2.	Each fixed length comparator instantiates the whole engine (Splitter, SplitStore, merges) again, so only the
+	//		in-memory and on-disk engines for the full sort record layouts (IMSR/IMSRP, ODSR/ODSRP) are dispatched by
+	//		key length. The partitioned and chunked engines and the compact sort record layouts are only instantiated
+	//		with the variable length comparator.
+	//
+
+	template <typename R, typename E>
+	bool	dispatchKeyLength(const SortArgs& Args) {
+		switch (Args.SKLen) {
+		case 4: return E::template run<R, FixedKeyCompare<4>>(*this, Args);
+		case 8: return E::template run<R, FixedKeyCompare<8>>(*this, Args);
+		case 10: return E::template run<R, FixedKeyCompare<10>>(*this, Args);
+		case 16: return E::template run<R, FixedKeyCompare<16>>(*this, Args);
+		case 20: return E::template run<R, FixedKeyCompare<20>>(*this, Args);
+		case 32: return E::template run<R, FixedKeyCompare<32>>(*this, Args);
+		default: return E::template run<R, VarKeyCompare>(*this, Args);
+		}
+	}
+
+	//  selectSplitKeys
+	//
+	//  This function will choose the splitter keys that range partition the passed sort records
+	//
+	//  PARAMETERS:
+	//
+	//		R*				-		Pointer to the array of sort records
+	//		size_t			-		Number of sort records
+	//		size_t			-		Length of the sort key
+	//		R*				-		Pointer to the array to receive the splitter keys
+	//		size_t			-		Number of partitions
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+	//	1.	A regular sample of up to 64 records per partition is sorted with a Splitter, the splitter keys are then
+	//		taken at equal intervals from the sorted sample. The last entry is not used.
+	//
+
+	template <typename R, typename C>
+	void	selectSplitKeys(R* pRecs, size_t Records, size_t SKLen, R* pSplitKeys, size_t Parts) {
+		size_t			SampleSize = Parts * 64;													//  Number of records in the sample
+		IStats			SampleStats;																//  Statistics for the sample sort
+		Splitter<R, C>* pSSR = nullptr;																//  Splitter for the sample
+		size_t			SIndex = 0;																	//  Index in the sorted sample
+
+		if (Parts < 2) return;
+		if (SampleSize > Records) SampleSize = Records;
+
+		//  Sort the sample
+		pSSR = new Splitter<R, C>(pRecs[0], SKLen, SampleStats);
+		for (size_t sIndex = 1; sIndex < SampleSize; sIndex++) pSSR->add(pRecs[(sIndex * Records) / SampleSize], true);
+		pSSR->signalEndOfSortInput();
+
+		//  If the sample could not be sorted then every splitter key is the first record (a single effective partition)
+		if (!pSSR->isOutputValid()) {
+			for (size_t pIndex = 1; pIndex < Parts; pIndex++) pSplitKeys[pIndex - 1] = pRecs[0];
+			delete pSSR;
+			return;
+		}
+
+		//  Take the splitter keys at equal intervals through the sorted sample
+		for (typename Splitter<R, C>::Output O = pSSR->lowest(); O <= pSSR->highest(); O++) {
+			for (size_t pIndex = 1; pIndex < Parts; pIndex++) {
+				if (((pIndex * SampleSize) / Parts) == SIndex) pSplitKeys[pIndex - 1] = *O;
+			}
+			SIndex++;
+		}
+
+		delete pSSR;
+
+		//  Return to caller
+		return;
+	}
+
+	//  freePartitions
+	//
+	//  This function will destroy the Splitter of each partition and the array that holds them
+	//
+	//  PARAMETERS:
+	//
+	//		Splitter**		-		Pointer to the array of partition Splitters
+	//		size_t			-		Number of partitions
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+
+	template <typename R, typename C>
+	void	freePartitions(Splitter<R, C>** pPartSR, size_t Parts) {
+		for (size_t pIndex = 0; pIndex < Parts; pIndex++) {
+			if (pPartSR[pIndex] != nullptr) delete pPartSR[pIndex];
+		}
+		free(pPartSR);
+		return;
+	}
+
+	//  bindRecord
+	//
+	//  This function will bind an in-memory sort record to the passed input record
+	//
+	//  PARAMETERS:
+	//
+	//		R&				-		Reference to the sort record
+	//		char*			-		Const pointer to the input record
+	//		size_t			-		Offset to the sort key
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+	//	1.	Compact record layouts (without a 'pRec' member) bind themselves.
+	//
+
+	template <typename R>
+	auto	bindRecord(R& SRec, const char* pRec, size_t SKOff, int) -> decltype(SRec.pRec, void()) {
+		SRec.pRec = pRec;
+		SRec.pKey = pRec + SKOff;
+		return;
+	}
+
+	template <typename R>
+	void	bindRecord(R& SRec, const char* pRec, size_t SKOff, long) { SRec.bind(pRec, SKOff); return; }
+
+	template <typename R>
+	void	bindRecord(R& SRec, const char* pRec, size_t SKOff) { bindRecord(SRec, pRec, SKOff, 0); return; }
+
+	//  recordOf
+	//
+	//  This function will return the input record that an in-memory sort record is bound to
+	//
+	//  PARAMETERS:
+	//
+	//		R&				-		Const reference to the sort record
+	//		size_t			-		Offset to the sort key
+	//
+	//  RETURNS:
+	//
+	//		char*			-		Const pointer to the input record
+	//
+	//  NOTES:
+	//
+
+	template <typename R>
+	auto	recordOf(const R& SRec, size_t, int) -> decltype(SRec.pRec) { return SRec.pRec; }
+
+	template <typename R>
+	const char*	recordOf(const R& SRec, size_t SKOff, long) { return SRec.rec(SKOff); }
+
+	template <typename R>
+	const char*	recordOf(const R& SRec, size_t SKOff) { return recordOf(SRec, SKOff, 0); }
+
+	//  getSortInputSize
+	//
+	//  This function will return the size of the sort input file
+	//
+	//  PARAMETERS:
+	//
+	//		char*		-		Const pointer to the sort input file name
+	//
+	//  RETURNS:
+	//
+	//		size_t		-		Size of the file, 0 if it cannot be opened
+	//
+	//  NOTES:
+	//
+
+	size_t	getSortInputSize(const char* szSortin) {
+		FILE*		pRFile = nullptr;																					//  Handle of the sortin file
+		size_t		FSize = 0;																							//  File size
+
+		if (fopen_s(&pRFile, szSortin, "rb") != 0 || pRFile == nullptr) return 0;
+		fseek(pRFile, 0, SEEK_END);
+		FSize = ftell(pRFile);
+		fclose(pRFile);
+		return FSize;
+	}
+
+	//  copyRecord
+	//
+	//  This function will copy an input record (including the record separator) to the output
+	//
+	//  PARAMETERS:
+	//
+	//		char*			-		Const pointer to the input record
+	//		char*			-		Const pointer to the End-Of-Input
+	//		char*			-		Pointer to the output position
+	//
+	//  RETURNS:
+	//
+	//		char*			-		Pointer to the next output position
+	//
+	//  NOTES:
+	//
+
+	char*	copyRecord(const char* pOutRec, const char* pEOI, char* pOutNext) {
+		const char* pEOR = CPUDispatch::findLF(pOutRec);
+		if (pEOR == nullptr) pEOR = pEOI;
+		size_t  RecLen = (pEOR - pOutRec) + 1;
+		memcpy(pOutNext, pOutRec, RecLen);
+		return pOutNext + RecLen;
+	}
+
+	//  allocImage
+	//
+	//  This function will allocate a buffer to hold a sort input image
+	//
+	//  PARAMETERS:
+	// 
+	//		size_t		-		Number of bytes required
+	//
+	//  RETURNS:
+	// 
+	//		char*		-		Pointer to the allocated buffer, nullptr if the allocation failed
+	//
+	//  NOTES:
+	// 
+	//	1.	The buffer is aligned on a 64 byte boundary and its length is rounded up to a multiple of 64 bytes with the
+	//		padding zeroed, every aligned block read by the vector newline scanners lies within the buffer.
+	//	2.	The buffer MUST be released with freeImage().
+	//
+
+	static char* allocImage(size_t Len) {
+		size_t		Padded = (Len + 63) & ~size_t(63);																	//  Padded length
+		char*		pImg = nullptr;																						//  Image buffer
+
+#if (defined(_MSC_VER))
+		pImg = (char*)_aligned_malloc(Padded, 64);
+#else
+		void*		pAlloc = nullptr;																					//  Allocated block
+
+		if (posix_memalign(&pAlloc, 64, Padded) == 0) pImg = (char*)pAlloc;
+#endif
+		if (pImg != nullptr) memset(pImg + Len, 0, Padded - Len);
+		return pImg;
+	}
+
+	//  freeImage
+	//
+	//  This function will release a buffer allocated by allocImage()
+	//
+	//  PARAMETERS:
+	// 
+	//		char*		-		Pointer to the buffer
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	// 
+
+	static void freeImage(char* pImg) {
+#if (defined(_MSC_VER))
+		_aligned_free(pImg);
+#else
+		free(pImg);
+#endif
+		return;
+	}
+
+	//  loadSortInput
+	//
+	//  This function will load the sort input into memory and normalise the end-of-file, any spurious empty records
+	//  will be removed from the end and the last record will be terminated with an appropriate end-line.
+	//
+	//  PARAMETERS:
+	// 
+	//		char*		-		Const pointer to the sort input file name
+	//		size_t&		-		Reference to the variable to hold the size of the loaded file
+	//
+	//  RETURNS:
+	// 
+	//		char*		-		Pointer to the allocated buffer holding the file contents
+	//
+	//  NOTES:
+	// 
+	//		The sortin file MUST be pre-checked for validity
+	//		Any problems encountered will result in a nullptr being returned and the size reported as zero
+	//		An image already loaded by the common prefix scan is handed over without reloading the file
+	//
+
+	char* loadSortInput(const char* szSortin, size_t& SILen) {
+		FILE*		pRFile = nullptr;																					//  Handle of the sortin file
+		errno_t		Result = 0;																							//  Return from fopen_s()
+		size_t		FSize = 0;																							//  File size
+		size_t		ElementsRead = 0;																					//  Number of alements read
+		char*		pFImg = nullptr;																					//  Sort input image
+		size_t		FixLen = 0;																							//  Fixed length of the file content
+		bool		B2IRS = false;																						//  2 byte IRS (cr/lf) in use
+		char*		pIRS = nullptr;																						//  Pointer to an IRS
+
+		//  Safety
+		SILen = 0;
+
+		//  Hand over the image already loaded by the common prefix scan
+		if (pPreload != nullptr) {
+			pFImg = pPreload;
+			SILen = PreloadSize;
+			pPreload = nullptr;
+			PreloadSize = 0;
+			return pFImg;
+		}
+
+		//  Open the file
+		Result = fopen_s(&pRFile, szSortin, "rb");
+		if (Result != 0 || pRFile == nullptr) {
+			Log << "ERROR: Unable to open file: '" << szSortin << "' - Open RC: " << Result << "." << std::endl;
+			return nullptr;
+		}
+
+		//  Determine the file size
+		fseek(pRFile, 0, SEEK_END);
+		FSize = ftell(pRFile);
+		rewind(pRFile);
+
+		//  Allocate a buffer to hold the file contents
+		//  3 additional bytes are allocated one for EOS (\0) and two for a possible cr/lf insert
+		pFImg = allocImage(FSize + 3);
+		if (pFImg == nullptr) {
+			fclose(pRFile);
+			Log << "ERROR: Failed to allocate: " << FSize << " bytes to hold the sort input." << std::endl;
+			return nullptr;
+		}
+
+		//  Read the content of the file into memory
+		ElementsRead = fread(pFImg, 1, FSize, pRFile);
+		fclose(pRFile);
+		if (ElementsRead != FSize) {
+			Log << "ERROR: Failed to load: " << FSize << " bytes of sort input into memory." << std::endl;
+			freeImage(pFImg);
+			return nullptr;
+		}
+
+		//  Make the image a well-formed string
+		pFImg[ElementsRead] = '\0';
+
+		//  Determine the IRS in use
+		FixLen = FSize;
+		pIRS = CPUDispatch::findLF(pFImg);
+		if (pIRS == nullptr) {
+			SILen = FixLen;
+			return pFImg;
+		}
+		if (pIRS == pFImg) {
+			SILen = FixLen;
+			return pFImg;
+		}
+		pIRS--;
+		if (*pIRS == SCHAR_CR) B2IRS = true;
+
+		//  Remove any cr/lf bytes from the end of the file
+		pIRS = pFImg + (FixLen - 1);
+		while ((*pIRS == SCHAR_CR || *pIRS == SCHAR_LF) && pIRS > pFImg) {
+			*pIRS = '\0';
+			FixLen--;
+			pIRS--;
+		}
+		pIRS++;
+
+		//  Add a new IRS onto the old record
+		if (B2IRS) {
+			*pIRS = SCHAR_CR;
+			FixLen++;
+			pIRS++;
+			*pIRS = SCHAR_LF;
+			FixLen++;
+		}
+		else {
+			*pIRS = SCHAR_LF;
+			FixLen++;
+		}
+
+		//  Return the loaded, normalised image
+		SILen = FixLen;
 		return pFImg;
 	}
 
+	//  eliminateCommonPrefix
+	//
+	//  This function will load the sort input into memory and determine the length of the prefix that is common to
+	//  every sort key in the input, the sort key offset and length are adjusted to exclude the common prefix.
+	//
+	//  PARAMETERS:
+	//
+	//		char*		-		Const pointer to the sort input file name
+	//		size_t&		-		Reference to the offset to the sort key, updated
+	//		size_t&		-		Reference to the length of the sort key, updated
+	//		IStats&		-		Reference to the statistics collector/reporter object
+	//
+	//  RETURNS:
+	//
+	//		bool		-		true if the sort input was loaded, otherwise false
+	//
+	//  NOTES:
+	//
+	//	1.	The loaded image is held and handed over by the next call to loadSortInput().
+	//	2.	The common prefix is refined against each record in turn, the scan stops once no prefix remains.
+	//	3.	At least one byte of the key is always retained, every byte removed is identical in every key so the
+	//		sequence (and the stability) of the sort is unchanged.
+	//
+
+	bool	eliminateCommonPrefix(const char* SFIn, size_t& SKOff, size_t& SKLen, IStats& Stats) {
+		char*		pEOI = nullptr;																						//  Pointer to the End-Of-Input
+		const char*	pFirst = nullptr;																					//  Key of the first record
+		const char*	pNextRec = nullptr;																					//  Pointer to the next record
+		size_t		CPL = 0;																							//  Common prefix length
+		size_t		Same = 0;																							//  Bytes matching the first key
+
+		//  Load the designated sort input into memory
+		Stats.startLoading();
+		if (pPreload != nullptr) {
+			freeImage(pPreload);
+			pPreload = nullptr;
+		}
+		pPreload = loadSortInput(SFIn, PreloadSize);
+		if (pPreload == nullptr) {
+			Log << "ERROR: Failed to load the sort input into memory, it may be too big to sort in-memory." << std::endl;
+			return false;
+		}
+		Stats.finishLoading();
+		if (PreloadSize == 0 || SKLen < 2) return true;
+
+		//  Refine the common prefix against every following record
+		pEOI = pPreload + PreloadSize;
+		pFirst = pPreload + SKOff;
+		CPL = SKLen - 1;
+		pNextRec = CPUDispatch::findLF(pPreload);
+		while (pNextRec != nullptr && CPL > 0) {
+			pNextRec++;
+			if (pNextRec >= pEOI) break;
+			if (memcmp(pFirst, pNextRec + SKOff, CPL) != 0) {
+				for (Same = 0; pFirst[Same] == pNextRec[SKOff + Same]; Same++);
+				CPL = Same;
+			}
+			pNextRec = CPUDispatch::findLF(pNextRec);
+		}
+
+		//  Sort on the remainder of the key
+		applyCommonPrefix(CPL, SKOff, SKLen);
+
+		//  Return showing success
+		return true;
+	}
+
+	//  eliminateCommonPrefix
+	//
+	//  This function will determine the length of the prefix that is common to every sort key in the on-disk sort
+	//  input, the sort key offset and length are adjusted to exclude the common prefix.
+	//
+	//  PARAMETERS:
+	//
+	//		char*		-		Const pointer to the sort input file name
+	//		size_t		-		Maximum record length
+	//		size_t&		-		Reference to the offset to the sort key, updated
+	//		size_t&		-		Reference to the length of the sort key, updated
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+	//	1.	The sort input is streamed, the common prefix is refined against each record as it is read and the pass
+	//		stops once no prefix remains. The keystore then holds only the remainder of each key.
+	//	2.	The prefix never extends beyond the end of a record, bytes past the end of a record are not part of the
+	//		record as it is read from the sort input.
+	//	3.	Any problem reading the sort input leaves the key unchanged, the sort itself reports the problem.
+	//
+
+	void	eliminateCommonPrefix(const char* SFIn, size_t MaxRecl, size_t& SKOff, size_t& SKLen) {
+		std::ifstream	Sortin;																							//  Sort input stream
+		char*			pFirst = nullptr;																				//  First record
+		char*			pRec = nullptr;																					//  Record buffer
+		size_t			RecLen = 0;																						//  Record length
+		size_t			CPL = 0;																						//  Common prefix length
+		size_t			Same = 0;																						//  Bytes matching the first key
+
+		if (SKLen < 2) return;
+
+		//  Open the sort input and read the first record
+		pFirst = (char*)calloc(2, MaxRecl);
+		if (pFirst == nullptr) return;
+		pRec = pFirst + MaxRecl;
+		Sortin.open(SFIn, std::istream::in);
+		if (!Sortin.is_open()) {
+			free(pFirst);
+			return;
+		}
+		Sortin.getline(pFirst, MaxRecl);
+		if (Sortin.fail()) {
+			free(pFirst);
+			Sortin.close();
+			return;
+		}
+		RecLen = strlen(pFirst);
+		CPL = SKLen - 1;
+		if (RecLen < SKOff + CPL) CPL = (RecLen > SKOff) ? RecLen - SKOff : 0;
+
+		//  Refine the common prefix against every following record
+		while (CPL > 0 && !Sortin.eof()) {
+			Sortin.getline(pRec, MaxRecl);
+			RecLen = strlen(pRec);
+			if (Sortin.eof() && RecLen == 0) break;
+			if (Sortin.fail()) {
+				CPL = 0;
+				break;
+			}
+			if (RecLen < SKOff + CPL) CPL = (RecLen > SKOff) ? RecLen - SKOff : 0;
+			if (CPL > 0 && memcmp(pFirst + SKOff, pRec + SKOff, CPL) != 0) {
+				for (Same = 0; pFirst[SKOff + Same] == pRec[SKOff + Same]; Same++);
+				CPL = Same;
+			}
+		}
+
+		Sortin.close();
+		free(pFirst);
+
+		//  Sort on the remainder of the key
+		applyCommonPrefix(CPL, SKOff, SKLen);
+
+		//  Return to caller
+		return;
+	}
+
+	//  applyCommonPrefix
+	//
+	//  This function will adjust the sort key offset and length to exclude the common key prefix.
+	//
+	//  PARAMETERS:
+	//
+	//		size_t		-		Length of the common key prefix
+	//		size_t&		-		Reference to the offset to the sort key, updated
+	//		size_t&		-		Reference to the length of the sort key, updated
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+
+	void	applyCommonPrefix(size_t CPL, size_t& SKOff, size_t& SKLen) {
+
+		if (Notifications) {
+			if (CPL == 0) Log << "INFO: The sort keys do not have a common prefix." << std::endl;
+			else Log << "INFO: A common prefix of: " << CPL << " bytes is eliminated, the sort key is now offset: " << SKOff + CPL << " length: " << SKLen - CPL << "." << std::endl;
+		}
+		SKOff += CPL;
+		SKLen -= CPL;
+
+		//  Return to caller
+		return;
+	}
+
 	//  stortSortOutput
 	//
 	//  This function will store the sort output from the passed memory buffer to the sortout file.
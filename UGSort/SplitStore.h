@@ -3,7 +3,7 @@
 //*																													*
 //*   File:       SplitStore.h																						*
 //*   Suite:      Experimental Algorithms																			*
-//*   Version:    1.17.0	(Build: 20)																				*
+//*   Version:    1.39.0	(Build: 43)																				*
 //*   Author:     Ian Tree/HMNL																						*
 //*																													*
 //*   Copyright 2017 - 2026 Ian J. Tree																				*
@@ -14,6 +14,8 @@
 //* The template parameter specifies a type for the internal sort records. Internal sort record types MUST contain	*
 //* a member 'pKey' that is a pointer to the key on which the records are to be sorted. It would be expected that	*
 //* the type also holds a reference to the location of the input sort record to which the key refers.				*
+//* The second template parameter is the key comparator policy (see KeyCompare.h), the default compares keys of		*
+//* any length.																										*
 //*																													*
 //*	ALGORITHM:																										*
 //*																													*
@@ -33,6 +35,19 @@
 //*	1.6.0 -		15/03/2023	-	Stable Key Handling																	*
 //*	1.15.0 -	25/08/2023	-	Binary-Chop search of Store Chain													*
 //*	1.17.0 -	28/01/2026	-	Include instrumentation package														*
+//*	1.18.0 -	16/10/2026	-	Merge bound checks and stable tie handling											*
+//*	1.19.0 -	16/10/2026	-	Merge-path partitioned merges														*
+//*	1.21.0 -	16/10/2026	-	Ping-pong merge buffers for the final merge											*
+//*	1.22.0 -	16/10/2026	-	Inline key prefix in sort records													*
+//*	1.23.0 -	16/10/2026	-	Comparator policy template parameter												*
+//*	1.25.0 -	16/10/2026	-	Natural run detection with bulk insertion											*
+//*	1.29.0 -	16/10/2026	-	Single pass k-way tail suppression													*
+//*	1.32.0 -	16/10/2026	-	Amortised preemptive merge															*
+//*	1.34.0 -	16/10/2026	-	Slab pool allocation of stores and initial SRAs										*
+//*	1.35.0 -	16/10/2026	-	Segmented double ended SRA storage													*
+//*	1.37.0 -	16/10/2026	-	Compact sort record formats															*
+//*	1.38.0 -	16/10/2026	-	Galloping and block copy merge kernels												*
+//*	1.39.0 -	16/10/2026	-	Branchless merge kernel																*
 //*																													*
 //*******************************************************************************************************************/
 
@@ -41,12 +56,17 @@
 
 //  Application Headers
 #include	"IStats.h"																		//  Instrumentation
+#include	"KeyCompare.h"																	//  Sort key comparison
+#include	"WorkerPool.h"																	//  Worker thread pool
+#include	"MergeBuffers.h"																//  Merge target buffer manager
+#include	"LoserTree.h"																	//  K-way merge tournament tree
+#include	"SlabPool.h"																	//  Slab pool allocator
 
 //
 //  Splitter Class Template
 //
 
-template <typename T>
+template <typename T, typename C = VarKeyCompare>
 class SplitStore {
 private:
 	//*******************************************************************************************************************
@@ -62,6 +82,16 @@ private:
 		char* pKey;																//  Pointer to the next key to store
 	} Arena;
 
+	//  State of a k-way merge that is performed in steps
+	typedef struct PendingMerge {
+		LoserTree<T, C>*	pTree;														//  K-way merge tournament
+		T*				pNewSRA;														//  New Sort Record Array (SRA)
+		size_t			NewCapacity;													//  Capacity of the new SRA
+		size_t			NewLo;															//  New array low entry index
+		size_t			Total;															//  Records in all of the stores
+		size_t			Moved;															//  Records moved so far
+	} PendingMerge;
+
 public:
 
 	//*******************************************************************************************************************
@@ -79,6 +109,7 @@ public:
 	//		T&				-		Reference to the initial record to be stored in the Store
 	//		size_t			-		Sort Key Length
 	//		IStats&			-		Reference to the instrumentation object
+	//		SlabPool*		-		Pointer to the pool for the initial SRA and segments (nullptr = heap)
 	// 
 	//
 	//  RETURNS:
@@ -86,16 +117,28 @@ public:
 	//  NOTES:
 	//
 
-	SplitStore<T>(T& IRec, size_t KeyLen, IStats& Ins) : SRANum(0), SRAHi(0), SRALo(0), KL(KeyLen), Stats(Ins), SRAInc(256) {
+	SplitStore(T& IRec, size_t KeyLen, IStats& Ins, SlabPool* pSP = nullptr) : SRANum(0), SRAHi(0), SRALo(0), KL(KeyLen), Stats(Ins), SRAInc(256) {
 
 		//  No keystore is used
 		pKeyStore = nullptr;
 		pLastArena = nullptr;
 		ArenaSize = 0;
 
+		//  Merge targets are allocated from the heap until a buffer manager is assigned
+		pBuffers = nullptr;
+		pPending = nullptr;
+		pSRAPool = nullptr;
+
+		//  No segments are held beyond the ends of the SRA, segments are drawn from the pool if their size fits
+		pLoSeg = pHiSeg = nullptr;
+		LoSegs = HiSegs = LoSegCap = HiSegCap = 0;
+		LoNext = 0;
+		HiNext = SRAInc;
+		pSegPool = (pSP != nullptr && (SRAInc * sizeof(T)) <= pSP->getSlotSize()) ? pSP : nullptr;
+
 		//  Initialise the Sort Records Array (SRA)
 		SRASize = SRAInc;
-		pSRA = (T*) malloc(SRASize * sizeof(T));
+		pSRA = acquireInitialSRA();
 		if (pSRA == nullptr) return;
 
 		//  Copy the initial sort record to the mid-point in the array
@@ -117,13 +160,26 @@ public:
 	//		size_t			-		Sort Key Length
 	//		size_t			-		Keystore Arena Size in KB
 	//		IStats&			-		Reference to the instrumentation object
+	//		SlabPool*		-		Pointer to the pool for the initial SRA and segments (nullptr = heap)
 	//
 	//  RETURNS:
 	//
 	//  NOTES:
 	//
 
-	SplitStore<T>(T& IRec, size_t KeyLen, size_t KSASizeKB, IStats& Ins) : SRANum(0), SRAHi(0), SRALo(0), KL(KeyLen), Stats(Ins), SRAInc(256) {
+	SplitStore(T& IRec, size_t KeyLen, size_t KSASizeKB, IStats& Ins, SlabPool* pSP = nullptr) : SRANum(0), SRAHi(0), SRALo(0), KL(KeyLen), Stats(Ins), SRAInc(256) {
+
+		//  Merge targets are allocated from the heap until a buffer manager is assigned
+		pBuffers = nullptr;
+		pPending = nullptr;
+		pSRAPool = nullptr;
+
+		//  No segments are held beyond the ends of the SRA, segments are drawn from the pool if their size fits
+		pLoSeg = pHiSeg = nullptr;
+		LoSegs = HiSegs = LoSegCap = HiSegCap = 0;
+		LoNext = 0;
+		HiNext = SRAInc;
+		pSegPool = (pSP != nullptr && (SRAInc * sizeof(T)) <= pSP->getSlotSize()) ? pSP : nullptr;
 
 		//  Initialise keystore 
 		ArenaSize = KSASizeKB * 1024;
@@ -139,7 +195,7 @@ public:
 
 		//  Initialise the Sort Records Array (SRA)
 		SRASize = SRAInc;
-		pSRA = (T*)malloc(SRASize * sizeof(T));
+		pSRA = acquireInitialSRA();
 		if (pSRA == nullptr) return;
 
 		//  Copy the initial sort record to the mid-point in the array
@@ -148,7 +204,7 @@ public:
 		SRANum = 1;
 
 		//  Copy the key to the keystore and update the record
-		pSRA[SRALo].pKey = addKeyToStore(pSRA[SRALo].pKey);
+		setKey(pSRA[SRALo], addKeyToStore(getKey(pSRA[SRALo])));
 
 		//  Return to caller
 		return;
@@ -174,8 +230,24 @@ public:
 
 	~SplitStore() {
 
+		//  Dismiss any merge in progress
+		if (pPending != nullptr) {
+			delete pPending->pTree;
+			releaseSRA(pPending->pNewSRA);
+			delete pPending;
+		}
+		pPending = nullptr;
+
+		//  Free the segments and their directories
+		for (size_t sIndex = 0; sIndex < LoSegs; sIndex++) releaseSegment(pLoSeg[sIndex]);
+		for (size_t sIndex = 0; sIndex < HiSegs; sIndex++) releaseSegment(pHiSeg[sIndex]);
+		if (pLoSeg != nullptr) free(pLoSeg);
+		if (pHiSeg != nullptr) free(pHiSeg);
+		pLoSeg = pHiSeg = nullptr;
+		LoSegs = HiSegs = 0;
+
 		//  Free the Sort Records Array (SRA)
-		if (pSRA != nullptr) free(pSRA);
+		if (pSRA != nullptr) releaseSRA(pSRA);
 		pSRA = nullptr;
 		SRASize = 0;
 		SRANum = 0;
@@ -200,6 +272,87 @@ public:
 		return;
 	}
 
+	//*******************************************************************************************************************
+	//*                                                                                                                 *
+	//*   Allocation Operators	                                                                                        *
+	//*                                                                                                                 *
+	//*******************************************************************************************************************
+
+	//  operator new
+	//
+	//  Allocates the storage for a new SplitStore from the passed pool
+	//
+	//  PARAMETERS:
+	//
+	//		size_t			-		Size of the object
+	//		SlabPool*		-		Pointer to the pool (nullptr = heap)
+	//
+	//  RETURNS:
+	//
+	//		void*			-		Pointer to the storage for the object
+	//
+	//  NOTES:
+	//
+	//	1.	The pool is recorded ahead of the object so that delete returns the storage to the pool that supplied it.
+	//
+
+	static void* operator new(size_t Size, SlabPool* pSP) {
+		char*		pMem = nullptr;																//  Allocated storage
+
+		if (pSP != nullptr && (Size + PoolTag) <= pSP->getSlotSize()) pMem = (char*) pSP->acquire();
+		else {
+			pSP = nullptr;
+			pMem = (char*) malloc(Size + PoolTag);
+		}
+		if (pMem == nullptr) throw std::bad_alloc();
+		*((SlabPool**) pMem) = pSP;
+		return pMem + PoolTag;
+	}
+
+	static void* operator new(size_t Size) { return operator new(Size, (SlabPool*) nullptr); }
+
+	//  operator delete
+	//
+	//  Returns the storage of a SplitStore to the pool that supplied it (or the heap)
+	//
+	//  PARAMETERS:
+	//
+	//		void*			-		Pointer to the object storage
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+
+	static void operator delete(void* pStore) {
+		char*		pMem = nullptr;																//  Allocated storage
+		SlabPool*	pSP = nullptr;																//  Pool that supplied the storage
+
+		if (pStore == nullptr) return;
+		pMem = ((char*) pStore) - PoolTag;
+		pSP = *((SlabPool**) pMem);
+		if (pSP != nullptr) pSP->release(pMem);
+		else free(pMem);
+		return;
+	}
+
+	static void operator delete(void* pStore, SlabPool*) { operator delete(pStore); return; }
+
+	//  getPoolSlotSize
+	//
+	//  Returns the size of the pool slot that holds a SplitStore
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//		size_t			-		Size of the slot (bytes)
+	//
+	//  NOTES:
+	//
+
+	static size_t getPoolSlotSize() { return sizeof(SplitStore<T, C>) + PoolTag; }
+
 	//*******************************************************************************************************************
 	//*                                                                                                                 *
 	//*   Public Members                                                                                                *
@@ -232,17 +385,7 @@ public:
 	// 
 
 	void	addLowKey(T& NewRec) {
-
-		//  Ensure that there is capacity for the new record
-		if (SRALo == 0) {
-			expandArray();
-			if (SRALo == 0) return;
-		}
-
-		//  Add the record to the array before the lowest entry
-		SRALo--;
-		memcpy(&pSRA[SRALo], &NewRec, sizeof(T));
-		SRANum++;
+		pushLow(NewRec);
 		return;
 	}
 
@@ -260,17 +403,72 @@ public:
 	// 
 
 	void	addHighKey(T& NewRec) {
+		pushHigh(NewRec);
+		return;
+	}
+
+	//  addLowKeys
+	//
+	//  Adds a descending run of records to the store below the low key position
+	//
+	//  PARAMETERS:
+	//
+	//		T*				-		Const pointer to the first (highest) record of the run
+	//		size_t			-		Number of records in the run
+	// 
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+	//	1.	The run is reversed as it is stored, the last record of the run becomes the new low key.
+	// 
 
-		//  Ensure that there is capacity for the new record
-		if (SRAHi == (SRASize - 1)) {
-			expandArray();
-			if (SRAHi == (SRASize - 1)) return;
+	void	addLowKeys(const T* pRun, size_t Count) {
+
+		//  Add the records one at a time, each becomes the new low key
+		for (size_t rIndex = 0; rIndex < Count; rIndex++) {
+			if (pushLow(pRun[rIndex]) == nullptr) return;
 		}
+		return;
+	}
 
-		//  Add the record to the array after the highest entry
-		SRAHi++;
-		memcpy(&pSRA[SRAHi], &NewRec, sizeof(T));
-		SRANum++;
+	//  addHighKeys
+	//
+	//  Adds an ascending run of records to the store above the high key position
+	//
+	//  PARAMETERS:
+	//
+	//		T*				-		Const pointer to the first (lowest) record of the run
+	//		size_t			-		Number of records in the run
+	// 
+	//  RETURNS:
+	//
+	//  NOTES:
+	// 
+
+	void	addHighKeys(const T* pRun, size_t Count) {
+		size_t		Chunk = 0;																//  Records copied in one piece
+
+		while (Count > 0) {
+			if (SRAHi < (SRASize - 1)) {
+				//  Fill the free space above the high key in the array
+				Chunk = (SRASize - 1) - SRAHi;
+				if (Chunk > Count) Chunk = Count;
+				memcpy(&pSRA[SRAHi + 1], pRun, Chunk * sizeof(T));
+				SRAHi += Chunk;
+			}
+			else {
+				//  Fill the outermost high segment
+				if (HiNext == SRAInc && !addHighSegment()) return;
+				Chunk = SRAInc - HiNext;
+				if (Chunk > Count) Chunk = Count;
+				memcpy(&pHiSeg[HiSegs - 1][HiNext], pRun, Chunk * sizeof(T));
+				HiNext += Chunk;
+			}
+			pRun += Chunk;
+			Count -= Chunk;
+			SRANum += Chunk;
+		}
 		return;
 	}
 
@@ -288,18 +486,9 @@ public:
 	// 
 
 	void	addLowExternalKey(T& NewRec) {
+		T*			pRec = pushLow(NewRec);													//  Stored record
 
-		//  Ensure that there is capacity for the new record
-		if (SRALo == 0) {
-			expandArray();
-			if (SRALo == 0) return;
-		}
-
-		//  Add the record to the array before the lowest entry
-		SRALo--;
-		memcpy(&pSRA[SRALo], &NewRec, sizeof(T));
-		pSRA[SRALo].pKey = addKeyToStore(pSRA[SRALo].pKey);
-		SRANum++;
+		if (pRec != nullptr) setKey(*pRec, addKeyToStore(getKey(*pRec)));
 		return;
 	}
 
@@ -317,19 +506,162 @@ public:
 	// 
 
 	void	addHighExternalKey(T& NewRec) {
+		T*			pRec = pushHigh(NewRec);												//  Stored record
+
+		if (pRec != nullptr) setKey(*pRec, addKeyToStore(getKey(*pRec)));
+		return;
+	}
+
+	//  lowRecord
+	//
+	//  Returns the lowest collating record in the store
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//		T&				-		Reference to the low key record
+	//
+	//  NOTES:
+	//
+
+	T& lowRecord() {
+		if (LoSegs == 0) return pSRA[SRALo];
+		return pLoSeg[LoSegs - 1][LoNext];
+	}
+
+	//  highRecord
+	//
+	//  Returns the highest collating record in the store
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//		T&				-		Reference to the high key record
+	//
+	//  NOTES:
+	//
+
+	T& highRecord() {
+		if (HiSegs == 0) return pSRA[SRAHi];
+		return pHiSeg[HiSegs - 1][HiNext - 1];
+	}
+
+	//  flatten
+	//
+	//  Copies the records of the store into a single contiguous Sort Record Array (SRA)
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//		bool			-		true if the records are contiguous, false if the new SRA could not be allocated
+	//
+	//  NOTES:
+	//
+	//	1.	Records added beyond either end of the SRA are held in fixed size segments, the merges, the k-way
+	//		tournament and the output iterator need the records of a store to be contiguous (pSRA[SRALo..SRAHi]).
+	//	2.	Does nothing if the store has no segments.
+	//	3.	On failure the store is left segmented, the records in the segments are NOT visible in pSRA.
+	//
+
+	bool	flatten() {
+		size_t			NewCapacity = SRANum + 256;													//  Capacity of the new array
+		size_t			NewLo = 128;																//  New array low entry index
+		T*				pNewSRA = nullptr;															//  New Sort Record Array (SRA)
+		T*				pOut = nullptr;																//  Next entry to be populated
+		size_t			First = 0;																	//  First record in a segment
+		size_t			Count = 0;																	//  Records in a segment
+
+		if (LoSegs == 0 && HiSegs == 0) return true;
 
-		//  Ensure that there is capacity for the new record
-		if (SRAHi == (SRASize - 1)) {
-			expandArray();
-			if (SRAHi == (SRASize - 1)) return;
+		//  Allocate the new array from the heap
+		pNewSRA = (T*)malloc(NewCapacity * sizeof(T));
+		if (pNewSRA == nullptr) {
+			std::cerr << "ERROR: SplitStore::flatten() failed to allocate a new SRA buffer (" << (NewCapacity * sizeof(T)) << " bytes)." << std::endl;
+			return false;
+		}
+		pOut = &pNewSRA[NewLo];
+
+		//  Low segments from the outermost in
+		for (size_t sIndex = LoSegs; sIndex > 0; sIndex--) {
+			First = (sIndex == LoSegs) ? LoNext : 0;
+			memcpy(pOut, &pLoSeg[sIndex - 1][First], (SRAInc - First) * sizeof(T));
+			pOut += SRAInc - First;
+			releaseSegment(pLoSeg[sIndex - 1]);
 		}
 
-		//  Add the record to the array after the highest entry
-		SRAHi++;
-		memcpy(&pSRA[SRAHi], &NewRec, sizeof(T));
-		pSRA[SRAHi].pKey = addKeyToStore(pSRA[SRAHi].pKey);
-		SRANum++;
-		return;
+		//  The array
+		memcpy(pOut, &pSRA[SRALo], ((SRAHi - SRALo) + 1) * sizeof(T));
+		pOut += (SRAHi - SRALo) + 1;
+
+		//  High segments from the innermost out
+		for (size_t sIndex = 0; sIndex < HiSegs; sIndex++) {
+			Count = (sIndex == (HiSegs - 1)) ? HiNext : SRAInc;
+			memcpy(pOut, pHiSeg[sIndex], Count * sizeof(T));
+			pOut += Count;
+			releaseSegment(pHiSeg[sIndex]);
+		}
+
+		//  Replace the array
+		releaseSRA(pSRA);
+		pSRA = pNewSRA;
+		SRASize = NewCapacity;
+		SRALo = NewLo;
+		SRAHi = SRALo + (SRANum - 1);
+		LoSegs = HiSegs = 0;
+		LoNext = 0;
+		HiNext = SRAInc;
+
+		//  Return showing success
+		return true;
+	}
+
+	//  setMergeBuffers
+	//
+	//  Assigns the buffer manager that supplies the target SRA for subsequent merges into this store
+	//
+	//  PARAMETERS:
+	// 
+	//		MergeBuffers*		-		Pointer to the buffer manager (nullptr = heap)
+	// 
+	//  RETURNS:
+	//
+	//  NOTES:
+	// 
+
+	void	setMergeBuffers(MergeBuffers<T>* pMB) { pBuffers = pMB; return; }
+
+	//  relocateSRA
+	//
+	//  Moves the records of the store into a new SRA allocated from the heap
+	//
+	//  PARAMETERS:
+	// 
+	//  RETURNS:
+	//
+	//		bool				-		true if the records were relocated, otherwise false
+	//
+	//  NOTES:
+	//
+	//	1.	Used to evacuate an SRA from a merge buffer arena that is about to be reused.
+	// 
+
+	bool	relocateSRA() {
+		T*			pNewSRA = nullptr;																//  New Sort Record Array (SRA)
+
+		//  A segmented store is relocated by flattening it into the heap
+		if (LoSegs > 0 || HiSegs > 0) return flatten();
+
+		pNewSRA = (T*)malloc(SRASize * sizeof(T));
+		if (pNewSRA == nullptr) return false;
+		memcpy(&pNewSRA[SRALo], &pSRA[SRALo], SRANum * sizeof(T));
+		releaseSRA(pSRA);
+		pSRA = pNewSRA;
+
+		//  Return showing success
+		return true;
 	}
 
 	//  mergeNextStore
@@ -339,34 +671,28 @@ public:
 	//  PARAMETERS:
 	// 
 	//		SplitStore*			-		Pointer to the next store
+	//		WorkerPool*			-		Pointer to the worker pool for a partitioned merge (nullptr = sequential)
+	//		bool				-		true if mergee records are placed ahead of target records on identical keys
 	// 
 	//  RETURNS:
 	//
 	//  NOTES:
+	//
+	//	1.	Unstable and stable ascending sequences keep target records ahead of mergee records on identical keys,
+	//		stable descending sequences place the mergee records first.
 	// 
 
-	void	mergeNextStore(SplitStore<T>* pNS) {
+	void	mergeNextStore(SplitStore<T, C>* pNS, WorkerPool* pPool = nullptr, bool MergeeFirst = false) {
 		size_t			NewCapacity = 0;																	//  Capacity of the new merged array
 		size_t			NewLo = 128;																		//  New array low entry index
-		size_t			NewEnt = NewLo;																		//  Next enttry to be poppulated
 		T* pNewSRA = nullptr;																	//  New Sort Record Array (SRA)
-		size_t			OldTEnt = SRALo;																	//  Next candidate (this)
-		size_t			OldMEnt = 0;																		//  Next candidate (merge)
 
 		//  Safety
 		if (pNS == nullptr) return;
-		NewCapacity = SRANum + pNS->SRANum + 256;
-		OldMEnt = pNS->SRALo;
-
-		//
-		//  If the splitters are a special case for merging then perform the special case merges
-		//
-		if (mergeSpecialCase(pNS)) return;
 
-		//  Allocate a new Sorted Record Array (SRA)
-		pNewSRA = (T*)malloc(NewCapacity * sizeof(T));
-		if (pNewSRA == nullptr) {
-			std::cerr << "ERROR: SplitStore::mergeNextStore() failed to allocate a new SRA buffer (" << (NewCapacity * sizeof(T)) << " bytes)." << std::endl;
+		//  Both stores MUST be contiguous
+		if (!flatten() || !pNS->flatten()) {
+			std::cerr << "ERROR: SplitStore::mergeNextStore() failed to make the stores contiguous for the merge." << std::endl;
 			//
 			//  The error is catastrophic - delete the Splitter that is to be merged to prevent looping on this error
 			//  The error will be picked up by a mismatch between the input and output record count
@@ -374,51 +700,44 @@ public:
 			delete pNS;
 			return;
 		}
+		NewCapacity = SRANum + pNS->SRANum + 256;
 
 		//
-		//  Merge Phase 1 - Copy from the old current array into the new array until the current key > merge key
+		//  If the splitters are a special case for merging then perform the special case merges
 		//
-
-		while (memcmp(pSRA[OldTEnt].pKey, pNS->pSRA[OldMEnt].pKey, KL) <= 0) {
-			memcpy(&pNewSRA[NewEnt], &pSRA[OldTEnt], sizeof(T));
-			NewEnt++;
-			OldTEnt++;
-		}
+		if (mergeSpecialCase(pNS, MergeeFirst)) return;
 
 		//
-		//  Merge Phase 2 - Copy from the lowest key of Current or merge until the merge array is exhausted
+		//  If a worker pool is provided then the merge is partitioned across the pool
 		//
+		if (pPool != nullptr) {
+			mergePartitioned(pNS, MergeeFirst, pPool);
+			return;
+		}
 
-		while (OldMEnt <= pNS->SRAHi) {
-			if (memcmp(pSRA[OldTEnt].pKey, pNS->pSRA[OldMEnt].pKey, KL) <= 0) {
-				//  Copy from the current array into the new array
-				memcpy(&pNewSRA[NewEnt], &pSRA[OldTEnt], sizeof(T));
-				OldTEnt++;
-			}
-			else {
-				//  Copy from the merge array into the new array
-				memcpy(&pNewSRA[NewEnt], &pNS->pSRA[OldMEnt], sizeof(T));
-				OldMEnt++;
-			}
-			NewEnt++;
+		//  Allocate a new Sorted Record Array (SRA)
+		pNewSRA = acquireSRA(NewCapacity);
+		if (pNewSRA == nullptr) {
+			std::cerr << "ERROR: SplitStore::mergeNextStore() failed to allocate a new SRA buffer (" << (NewCapacity * sizeof(T)) << " bytes)." << std::endl;
+			//
+			//  The error is catastrophic - delete the Splitter that is to be merged to prevent looping on this error
+			//  The error will be picked up by a mismatch between the input and output record count
+			//
+			delete pNS;
+			return;
 		}
 
 		//
-		//  Merge Phase 3 - Copy the residue from the current old array into the new array
+		//  Merge the target and mergee arrays into the new array, runs are located by galloping and block copied
 		//
 
-		while (OldTEnt <= SRAHi) {
-			//  Copy from current into the new array
-			memcpy(&pNewSRA[NewEnt], &pSRA[OldTEnt], sizeof(T));
-			OldTEnt++;
-			NewEnt++;
-		}
+		mergeRange(&pSRA[SRALo], SRANum, &pNS->pSRA[pNS->SRALo], pNS->SRANum, &pNewSRA[NewLo], MergeeFirst);
 
 		//
 		//  Update the current splitter with the new array
 		//
 
-		free(pSRA);
+		releaseSRA(pSRA);
 		pSRA = pNewSRA;
 		SRASize = NewCapacity;
 		SRANum += pNS->SRANum;
@@ -440,150 +759,528 @@ public:
 		return;
 	}
 
-	//  mergeNextStoreAscending
+	//  hasKeyStore
+	//
+	//  Determines if the keys of the store are held in a keystore (on-disk model)
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//		bool				-		true if the store has a keystore, otherwise false
+	//
+	//  NOTES:
+	//
+
+	bool	hasKeyStore() const { return pKeyStore != nullptr; }
+
+	//  mergeFollowingStores
 	//
-	//  Merges the next splitter store on the chain into this store, keys are stable and sort is in ascending sequence
+	//  Merges the stores that follow this store on the chain into this store in a single pass (k-way merge)
 	//
 	//  PARAMETERS:
 	// 
-	//		SplitStore*			-		Pointer to the next store
+	//		SplitStore**		-		Pointer to the array of stores, [0] MUST be this store followed by the mergees
+	//		size_t				-		Number of stores in the array (including this store)
+	//		bool				-		true if mergee records are placed ahead of target records on identical keys
+	//		size_t				-		Maximum number of records to move in this call (default: all)
 	// 
 	//  RETURNS:
 	//
+	//		bool				-		true if the merge is complete, false if it must be continued
+	//
 	//  NOTES:
+	//
+	//	1.	Every record is copied once into a single new SRA, merging the stores pairwise in turn copies the growing
+	//		array once for every mergee.
+	//	2.	Identical keys are taken from the stores in chain sequence, or in reverse chain sequence if mergee records
+	//		are placed ahead of target records (stable descending sequences).
+	//	3.	The caller MUST clear the pointers to the mergees in the array, the mergees are disposed of.
+	//	4.	The keystore arenas of the mergees are chained on to the keystore, they are not compacted.
+	//	5.	An incomplete merge is continued by calling again with the same array, no store in the array may be
+	//		changed until the merge is complete.
 	// 
 
-	void	mergeNextStoreAscending(SplitStore<T>* pNS) {
-		size_t			NewCapacity = 0;																	//  Capacity of the new merged array
-		size_t			NewLo = 128;																		//  New array low entry index
-		size_t			NewEnt = NewLo;																		//  Next enttry to be poppulated
-		T* pNewSRA = nullptr;																	//  New Sort Record Array (SRA)
-		size_t			OldTEnt = SRALo;																	//  Next candidate (this)
-		size_t			OldMEnt = 0;																		//  Next candidate (merge)
+	bool	mergeFollowingStores(SplitStore<T, C>** pStores, size_t Count, bool MergeeFirst, size_t MaxMoves = SIZE_MAX) {
+		size_t			Moves = 0;																			//  Records moved in this call
+		T* pRec = nullptr;																		//  Next record from the merge
 
 		//  Safety
-		if (pNS == nullptr) return;
-		NewCapacity = SRANum + pNS->SRANum + 256;
-		OldMEnt = pNS->SRALo;
+		if (Count < 2 || pStores[0] != this) return true;
 
 		//
-		//  If the splitters are a special case for merging then perform the special case merges
+		//  Start the merge, allocate the new array and build the tournament
 		//
-		if (mergeSpecialCase(pNS)) return;
 
-		//  Allocate a new Sorted Record Array (SRA)
-		pNewSRA = (T*)malloc(NewCapacity * sizeof(T));
-		if (pNewSRA == nullptr) {
-			std::cerr << "ERROR: SplitStore::mergeNextStore() failed to allocate a new SRA buffer (" << (NewCapacity * sizeof(T)) << " bytes)." << std::endl;
-			//
-			//  The error is catastrophic - delete the Splitter that is to be merged to prevent looping on this error
-			//  The error will be picked up by a mismatch between the input and output record count
-			//
-			delete pNS;
-			return;
+		if (pPending == nullptr) {
+			pPending = new PendingMerge;
+			pPending->Total = 0;
+			for (size_t sIndex = 0; sIndex < Count; sIndex++) {
+				if (!pStores[sIndex]->flatten()) {
+					std::cerr << "ERROR: SplitStore::mergeFollowingStores() failed to make the stores contiguous for the merge." << std::endl;
+					//
+					//  The error is catastrophic - delete the Splitters that are to be merged to prevent looping on this error
+					//  The error will be picked up by a mismatch between the input and output record count
+					//
+					for (size_t dIndex = 1; dIndex < Count; dIndex++) delete pStores[dIndex];
+					delete pPending;
+					pPending = nullptr;
+					return true;
+				}
+				pPending->Total += pStores[sIndex]->SRANum;
+			}
+			pPending->NewCapacity = pPending->Total + 256;
+			pPending->NewLo = 128;
+			pPending->Moved = 0;
+
+			//  Allocate a new Sorted Record Array (SRA)
+			pPending->pNewSRA = acquireSRA(pPending->NewCapacity);
+			if (pPending->pNewSRA == nullptr) {
+				std::cerr << "ERROR: SplitStore::mergeFollowingStores() failed to allocate a new SRA buffer (" << (pPending->NewCapacity * sizeof(T)) << " bytes)." << std::endl;
+				//
+				//  The error is catastrophic - delete the Splitters that are to be merged to prevent looping on this error
+				//  The error will be picked up by a mismatch between the input and output record count
+				//
+				for (size_t sIndex = 1; sIndex < Count; sIndex++) delete pStores[sIndex];
+				delete pPending;
+				pPending = nullptr;
+				return true;
+			}
+
+			//  For mergee first ties the tournament runs from the high keys down
+			pPending->pTree = new LoserTree<T, C>(pStores, Count, KL, !MergeeFirst);
 		}
 
 		//
-		//  Merge Phase 1 - Copy from the old current array into the new array until the current key > merge key
+		//  Move records from the tournament into the new array
 		//
 
-		while (memcmp(pSRA[OldTEnt].pKey, pNS->pSRA[OldMEnt].pKey, KL) <= 0) {
-			memcpy(&pNewSRA[NewEnt], &pSRA[OldTEnt], sizeof(T));
-			NewEnt++;
-			OldTEnt++;
+		{
+			LoserTree<T, C>*	pTree = pPending->pTree;												//  K-way merge
+			T*					pNewEnt = nullptr;														//  Next entry to be populated
+
+			Moves = pPending->Total - pPending->Moved;
+			if (Moves > MaxMoves) Moves = MaxMoves;
+			if (MergeeFirst) pNewEnt = &pPending->pNewSRA[pPending->NewLo + (pPending->Total - 1) - pPending->Moved];
+			else pNewEnt = &pPending->pNewSRA[pPending->NewLo + pPending->Moved];
+			for (size_t mIndex = 0; mIndex < Moves; mIndex++) {
+				pRec = pTree->next();
+				memcpy(pNewEnt, pRec, sizeof(T));
+				if (MergeeFirst) pNewEnt--;
+				else pNewEnt++;
+			}
+			pPending->Moved += Moves;
 		}
+		if (pPending->Moved < pPending->Total) return false;
 
 		//
-		//  Merge Phase 2 - Copy from the lowest key of Current or merge until the merge array is exhausted
-		//  Favours the leftmost (target) on identical keys
+		//  Update the current splitter with the new array
 		//
 
-		while (OldMEnt <= pNS->SRAHi) {
-			if (memcmp(pSRA[OldTEnt].pKey, pNS->pSRA[OldMEnt].pKey, KL) <= 0) {
-				//  Copy from the current array into the new array
-				memcpy(&pNewSRA[NewEnt], &pSRA[OldTEnt], sizeof(T));
-				OldTEnt++;
-			}
-			else {
-				//  Copy from the merge array into the new array
-				memcpy(&pNewSRA[NewEnt], &pNS->pSRA[OldMEnt], sizeof(T));
-				OldMEnt++;
+		releaseSRA(pSRA);
+		pSRA = pPending->pNewSRA;
+		SRASize = pPending->NewCapacity;
+		SRANum = pPending->Total;
+		SRALo = pPending->NewLo;
+		SRAHi = SRALo + (SRANum - 1);
+		delete pPending->pTree;
+		delete pPending;
+		pPending = nullptr;
+
+		//  If the splitters are using a keystore then the mergee keystore chains of arenas are appended to the target chain.
+		for (size_t sIndex = 1; sIndex < Count; sIndex++) {
+			if (pKeyStore != nullptr) {
+				pLastArena->pNext = pStores[sIndex]->pKeyStore;
+				pLastArena = pStores[sIndex]->pLastArena;
+				pStores[sIndex]->pKeyStore = nullptr;
+				pStores[sIndex]->pLastArena = nullptr;
 			}
-			NewEnt++;
+
+			//  Dispose of the merged store
+			delete pStores[sIndex];
 		}
 
-		//
-		//  Merge Phase 3 - Copy the residue from the current old array into the new array
-		//
+		//  Return showing the merge is complete
+		return true;
+	}
 
-		while (OldTEnt <= SRAHi) {
-			//  Copy from current into the new array
-			memcpy(&pNewSRA[NewEnt], &pSRA[OldTEnt], sizeof(T));
-			OldTEnt++;
-			NewEnt++;
+private:
+
+	//*******************************************************************************************************************
+	//*                                                                                                                 *
+	//*   Private Constants		                                                                                        *
+	//*                                                                                                                 *
+	//*******************************************************************************************************************
+
+	static const size_t	PoolTag = 16;														//  Pool reference ahead of a pooled store
+	static const size_t	MinGallop = 7;														//  Consecutive wins before a merge gallops
+	static const size_t	MaxKernelBackoff = 512;												//  Longest record by record merge between kernel calls
+
+	//*******************************************************************************************************************
+	//*                                                                                                                 *
+	//*   Private Members			                                                                                    *
+	//*                                                                                                                 *
+	//*******************************************************************************************************************
+
+	//  Configuration
+	size_t			KL;																		//  Key Length
+	IStats& Stats;																	//  Instrumentation
+
+	//  Sort Record Array
+	size_t			SRASize;																//  Size of the sort record array
+	size_t			SRAInc;																	//  Initial SRA size and segment size (records)
+	SlabPool*		pSRAPool;																//  Pool that holds the SRA (nullptr = heap or merge buffers)
+
+	//  Segments held below the low key and above the high key of the SRA
+	T**				pLoSeg;																	//  Low segment directory, [0] is nearest the SRA
+	T**				pHiSeg;																	//  High segment directory, [0] is nearest the SRA
+	size_t			LoSegs;																	//  Number of low segments
+	size_t			HiSegs;																	//  Number of high segments
+	size_t			LoSegCap;																//  Capacity of the low segment directory
+	size_t			HiSegCap;																//  Capacity of the high segment directory
+	size_t			LoNext;																	//  Index of the low key in the outermost low segment
+	size_t			HiNext;																	//  Next free entry in the outermost high segment
+	SlabPool*		pSegPool;																//  Pool for the segments (nullptr = heap)
+
+	//  Keystore
+	Arena* pKeyStore;																//  First arena in the keystore
+	Arena* pLastArena;																//  Last arena in the keystore
+	size_t			ArenaSize;																//  Arena size (bytes)
+
+	//  Merge Buffers
+	MergeBuffers<T>* pBuffers;															//  Merge target buffer manager (nullptr = heap)
+	PendingMerge*	pPending;																//  K-way merge in progress (nullptr = none)
+
+	//*******************************************************************************************************************
+	//*                                                                                                                 *
+	//*   Private Functions                                                                                             *
+	//*                                                                                                                 *
+	//*******************************************************************************************************************
+
+	//  addKeyToStore
+	//
+	//  Returns a pointer to the copy of the passed key in the keystore
+	//
+	//  PARAMETERS:
+	//
+	//		char*			-		Const pointer to the key to be added to the keystore
+	//
+	//  RETURNS:
+	// 
+	//		char*			-		Pointer to the copy of the key in the keystore
+	//
+	//  NOTES:
+	//  
+
+	char* addKeyToStore(const char* pKey) {
+		char* pSKey = nullptr;														//  Pointer to key in the store
+
+		//  Check that there is enough free space in the last arena of the keystore
+		if (pLastArena->FreeSpace < KL) {
+			//  Add an additional arena to the keystore
+			pLastArena->pNext = (Arena*)malloc(ArenaSize);
+			if (pLastArena->pNext == nullptr) return nullptr;
+			pLastArena->pNext->pNext = nullptr;
+			pLastArena->pNext->FreeSpace = ArenaSize - sizeof(Arena);
+			pLastArena->pNext->pKey = (char*)(pLastArena->pNext + 1);
+			pLastArena = pLastArena->pNext;
 		}
 
-		//
-		//  Update the current splitter with the new array
-		//
+		//  Copy the key into the keystore and update the arena header
+		pSKey = pLastArena->pKey;
+		memcpy(pLastArena->pKey, pKey, KL);
+		pLastArena->FreeSpace -= KL;
+		pLastArena->pKey += KL;
 
-		free(pSRA);
-		pSRA = pNewSRA;
-		SRASize = NewCapacity;
-		SRANum += pNS->SRANum;
-		SRALo = NewLo;
-		SRAHi = SRALo + (SRANum - 1);
+		//  Return pointer to the key
+		return pSKey;
+	}
 
-		//  If the splitters are using a keystore then the mergee keystore chain of arenas is appended to the target chain.
-		if (pKeyStore != nullptr) {
-			pLastArena->pNext = pNS->pKeyStore;
-			pLastArena = pNS->pLastArena;
-			pNS->pKeyStore = nullptr;
-			pNS->pLastArena = nullptr;
+	//  acquireSRA
+	//
+	//  Returns a new Sort Records Array (SRA) to be the target of a merge
+	//
+	//  PARAMETERS:
+	//
+	//		size_t			-		Capacity of the new array (records)
+	//
+	//  RETURNS:
+	// 
+	//		T*				-		Pointer to the new array, nullptr if the allocation failed
+	//
+	//  NOTES:
+	//  
+
+	T* acquireSRA(size_t Capacity) {
+		if (pBuffers != nullptr) return pBuffers->acquire(Capacity);
+		return (T*)malloc(Capacity * sizeof(T));
+	}
+
+	//  acquireInitialSRA
+	//
+	//  Returns the initial Sort Records Array (SRA) of a new store
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	// 
+	//		T*				-		Pointer to the new array, nullptr if the allocation failed
+	//
+	//  NOTES:
+	//
+	//	1.	The initial SRA is the size of a segment, it is drawn from the segment pool (if any).
+	//  
+
+	T* acquireInitialSRA() {
+		if (pSegPool != nullptr) {
+			pSRAPool = pSegPool;
+			return (T*)pSegPool->acquire();
 		}
+		return (T*)malloc(SRASize * sizeof(T));
+	}
 
-		//  Dispose of the merged store
-		delete pNS;
+	//  releaseSRA
+	//
+	//  Releases a Sort Records Array (SRA) that is no longer required
+	//
+	//  PARAMETERS:
+	//
+	//		T*				-		Pointer to the array
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//  
 
-		//  Return to caller
+	void	releaseSRA(T* pOldSRA) {
+		if (pOldSRA == pSRA && pSRAPool != nullptr) {
+			pSRAPool->release(pOldSRA);
+			pSRAPool = nullptr;
+			return;
+		}
+		if (pBuffers != nullptr) pBuffers->release(pOldSRA);
+		else free(pOldSRA);
 		return;
 	}
 
-	//  mergeNextStoreDescending
+	//  pushLow
 	//
-	//  Merges the next splitter store on the chain into this store, keys are stable and sort is in ascending sequence
+	//  Stores the passed record below the low key
 	//
 	//  PARAMETERS:
+	//
+	//		T&				-		Const reference to the Sort Record to be added
+	//
+	//  RETURNS:
 	// 
-	//		SplitStore*			-		Pointer to the next store
+	//		T*				-		Pointer to the stored record, nullptr if no storage is available
+	//
+	//  NOTES:
+	//
+	//	1.	Free entries below the low key in the SRA are used first, then the low segments.
+	//  
+
+	T* pushLow(const T& NewRec) {
+		T*			pRec = nullptr;															//  Stored record
+
+		if (SRALo > 0) {
+			SRALo--;
+			pRec = &pSRA[SRALo];
+		}
+		else {
+			if (LoNext == 0 && !addLowSegment()) return nullptr;
+			LoNext--;
+			pRec = &pLoSeg[LoSegs - 1][LoNext];
+		}
+		memcpy(pRec, &NewRec, sizeof(T));
+		SRANum++;
+		return pRec;
+	}
+
+	//  pushHigh
+	//
+	//  Stores the passed record above the high key
+	//
+	//  PARAMETERS:
+	//
+	//		T&				-		Const reference to the Sort Record to be added
+	//
+	//  RETURNS:
+	// 
+	//		T*				-		Pointer to the stored record, nullptr if no storage is available
+	//
+	//  NOTES:
+	//
+	//	1.	Free entries above the high key in the SRA are used first, then the high segments.
+	//  
+
+	T* pushHigh(const T& NewRec) {
+		T*			pRec = nullptr;															//  Stored record
+
+		if (SRAHi < (SRASize - 1)) {
+			SRAHi++;
+			pRec = &pSRA[SRAHi];
+		}
+		else {
+			if (HiNext == SRAInc && !addHighSegment()) return nullptr;
+			pRec = &pHiSeg[HiSegs - 1][HiNext];
+			HiNext++;
+		}
+		memcpy(pRec, &NewRec, sizeof(T));
+		SRANum++;
+		return pRec;
+	}
+
+	//  addLowSegment
+	//
+	//  Adds a new outermost low segment
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	// 
+	//		bool			-		true if the segment was added, otherwise false
+	//
+	//  NOTES:
+	//  
+
+	bool	addLowSegment() {
+		T*			pSeg = nullptr;															//  New segment
+
+		if (!expandDirectory(pLoSeg, LoSegs, LoSegCap)) return false;
+		pSeg = acquireSegment();
+		if (pSeg == nullptr) return false;
+		pLoSeg[LoSegs++] = pSeg;
+		LoNext = SRAInc;
+		return true;
+	}
+
+	//  addHighSegment
+	//
+	//  Adds a new outermost high segment
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
 	// 
+	//		bool			-		true if the segment was added, otherwise false
+	//
+	//  NOTES:
+	//  
+
+	bool	addHighSegment() {
+		T*			pSeg = nullptr;															//  New segment
+
+		if (!expandDirectory(pHiSeg, HiSegs, HiSegCap)) return false;
+		pSeg = acquireSegment();
+		if (pSeg == nullptr) return false;
+		pHiSeg[HiSegs++] = pSeg;
+		HiNext = 0;
+		return true;
+	}
+
+	//  expandDirectory
+	//
+	//  Ensures that there is room for one more segment in a segment directory
+	//
+	//  PARAMETERS:
+	//
+	//		T**&			-		Reference to the directory
+	//		size_t			-		Number of segments in the directory
+	//		size_t&			-		Reference to the capacity of the directory
+	//
 	//  RETURNS:
+	// 
+	//		bool			-		true if there is room, otherwise false
 	//
 	//  NOTES:
+	//  
+
+	bool	expandDirectory(T**& pDir, size_t Segs, size_t& Cap) {
+		T**			pNewDir = nullptr;														//  Reallocated directory
+
+		size_t		NewCap = (Cap == 0) ? 8 : (Cap * 2);									//  New capacity
+
+		if (Segs < Cap) return true;
+		pNewDir = (T**)realloc(pDir, NewCap * sizeof(T*));
+		if (pNewDir == nullptr) return false;
+		pDir = pNewDir;
+		Cap = NewCap;
+		return true;
+	}
+
+	//  acquireSegment
+	//
+	//  Returns a new segment
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
 	// 
+	//		T*				-		Pointer to the segment, nullptr if the allocation failed
+	//
+	//  NOTES:
+	//  
 
-	void	mergeNextStoreDescending(SplitStore<T>* pNS) {
-		size_t			NewCapacity = 0;																	//  Capacity of the new merged array
-		size_t			NewLo = 128;																		//  New array low entry index
-		size_t			NewEnt = NewLo;																		//  Next enttry to be poppulated
-		T* pNewSRA = nullptr;																	//  New Sort Record Array (SRA)
-		size_t			OldTEnt = SRALo;																	//  Next candidate (this)
-		size_t			OldMEnt = 0;																		//  Next candidate (merge)
+	T* acquireSegment() {
+		if (pSegPool != nullptr) return (T*)pSegPool->acquire();
+		return (T*)malloc(SRAInc * sizeof(T));
+	}
 
-		//  Safety
-		if (pNS == nullptr) return;
-		NewCapacity = SRANum + pNS->SRANum + 256;
-		OldMEnt = pNS->SRALo;
+	//  releaseSegment
+	//
+	//  Releases a segment that is no longer required
+	//
+	//  PARAMETERS:
+	//
+	//		T*				-		Pointer to the segment
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//  
 
-		//
-		//  If the splitters are a special case for merging then perform the special case merges
-		//
-		if (mergeSpecialCase(pNS)) return;
+	void	releaseSegment(T* pSeg) {
+		if (pSegPool != nullptr) pSegPool->release(pSeg);
+		else free(pSeg);
+		return;
+	}
+
+	//  mergePartitioned
+	//
+	//  Merges the next splitter store into the current one, the merge is cut into independent partitions that are
+	//  merged concurrently by the passed worker pool.
+	//
+	//  PARAMETERS:
+	// 
+	//		SplitStore*			-		Pointer to the next store in the chain
+	//		bool				-		true if mergee records are placed ahead of target records on identical keys
+	//		WorkerPool*			-		Pointer to the worker pool
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+	//	1.	The partition boundaries are found by co-ranking (merge-path), for each boundary on the output a binary
+	//		search finds how many of the records before it come from each of the two input arrays. Identical keys are
+	//		ordered by the same rule as the sequential merge so stable sequences are preserved.
+	//  
+
+	void	mergePartitioned(SplitStore<T, C>* pNS, bool MergeeFirst, WorkerPool* pPool) {
+		size_t			NewCapacity = SRANum + pNS->SRANum + 256;											//  Capacity of the new merged array
+		size_t			NewLo = 128;																		//  New array low entry index
+		T* pNewSRA = nullptr;																	//  New Sort Record Array (SRA)
+		size_t			Total = SRANum + pNS->SRANum;														//  Total records to merge
+		size_t			Parts = pPool->getThreads();														//  Number of partitions
+		const T*		pA = &pSRA[SRALo];																	//  Target records
+		const T*		pB = &pNS->pSRA[pNS->SRALo];														//  Mergee records
+		size_t			NA = SRANum;																		//  Number of target records
+		size_t			NB = pNS->SRANum;																	//  Number of mergee records
 
 		//  Allocate a new Sorted Record Array (SRA)
-		pNewSRA = (T*)malloc(NewCapacity * sizeof(T));
+		pNewSRA = acquireSRA(NewCapacity);
 		if (pNewSRA == nullptr) {
-			std::cerr << "ERROR: SplitStore::mergeNextStore() failed to allocate a new SRA buffer (" << (NewCapacity * sizeof(T)) << " bytes)." << std::endl;
+			std::cerr << "ERROR: SplitStore::mergePartitioned() failed to allocate a new SRA buffer (" << (NewCapacity * sizeof(T)) << " bytes)." << std::endl;
 			//
 			//  The error is catastrophic - delete the Splitter that is to be merged to prevent looping on this error
 			//  The error will be picked up by a mismatch between the input and output record count
@@ -592,51 +1289,21 @@ public:
 			return;
 		}
 
-		//
-		//  Merge Phase 1 - Copy from the old current array into the new array until the current key > merge key
-		//
+		//  Merge each partition, the partition boundaries are located by each task
+		pPool->dispatch(Parts, [this, pA, pB, NA, NB, Total, Parts, MergeeFirst, pNewSRA, NewLo](size_t Part) {
+			size_t		Diag = (Total * Part) / Parts;
+			size_t		NextDiag = (Total * (Part + 1)) / Parts;
+			size_t		AStart = coRank(pA, NA, pB, NB, Diag, MergeeFirst);
+			size_t		AEnd = coRank(pA, NA, pB, NB, NextDiag, MergeeFirst);
 
-		while (memcmp(pSRA[OldTEnt].pKey, pNS->pSRA[OldMEnt].pKey, KL) <= 0) {
-			memcpy(&pNewSRA[NewEnt], &pSRA[OldTEnt], sizeof(T));
-			NewEnt++;
-			OldTEnt++;
-		}
-
-		//
-		//  Merge Phase 2 - Copy from the lowest key of Current or merge until the merge array is exhausted
-		//  Favours the rightmost (target) on identical keys
-		//
-
-		while (OldMEnt <= pNS->SRAHi) {
-			if (memcmp(pSRA[OldTEnt].pKey, pNS->pSRA[OldMEnt].pKey, KL) < 0) {
-				//  Copy from the current array into the new array
-				memcpy(&pNewSRA[NewEnt], &pSRA[OldTEnt], sizeof(T));
-				OldTEnt++;
-			}
-			else {
-				//  Copy from the merge array into the new array
-				memcpy(&pNewSRA[NewEnt], &pNS->pSRA[OldMEnt], sizeof(T));
-				OldMEnt++;
-			}
-			NewEnt++;
-		}
-
-		//
-		//  Merge Phase 3 - Copy the residue from the current old array into the new array
-		//
-
-		while (OldTEnt <= SRAHi) {
-			//  Copy from current into the new array
-			memcpy(&pNewSRA[NewEnt], &pSRA[OldTEnt], sizeof(T));
-			OldTEnt++;
-			NewEnt++;
-		}
+			mergeRange(&pA[AStart], AEnd - AStart, &pB[Diag - AStart], (NextDiag - AEnd) - (Diag - AStart), &pNewSRA[NewLo + Diag], MergeeFirst);
+		});
 
 		//
 		//  Update the current splitter with the new array
 		//
 
-		free(pSRA);
+		releaseSRA(pSRA);
 		pSRA = pNewSRA;
 		SRASize = NewCapacity;
 		SRANum += pNS->SRANum;
@@ -658,117 +1325,243 @@ public:
 		return;
 	}
 
-private:
-
-	//*******************************************************************************************************************
-	//*                                                                                                                 *
-	//*   Private Members			                                                                                    *
-	//*                                                                                                                 *
-	//*******************************************************************************************************************
-
-	//  Configuration
-	size_t			KL;																		//  Key Length
-	IStats& Stats;																	//  Instrumentation
-
-	//  Sort Record Array
-	size_t			SRASize;																//  Size of the sort record array
-	size_t			SRAInc;																	//  Sort record array increment size
+	//  coRank
+	//
+	//  Returns the number of records from the first array that precede the passed position in the merged output
+	//
+	//  PARAMETERS:
+	// 
+	//		T*					-		Const pointer to the first (target) array
+	//		size_t				-		Number of records in the first array
+	//		T*					-		Const pointer to the second (mergee) array
+	//		size_t				-		Number of records in the second array
+	//		size_t				-		Position in the merged output
+	//		bool				-		true if mergee records are placed ahead of target records on identical keys
+	//
+	//  RETURNS:
+	//
+	//		size_t				-		Number of records from the first array that precede the position
+	//
+	//  NOTES:
+	//  
 
-	//  Keystore
-	Arena* pKeyStore;																//  First arena in the keystore
-	Arena* pLastArena;																//  Last arena in the keystore
-	size_t			ArenaSize;																//  Arena size (bytes)
+	size_t	coRank(const T* pA, size_t NA, const T* pB, size_t NB, size_t Diag, bool MergeeFirst) {
+		size_t			Lo = (Diag > NB) ? Diag - NB : 0;											//  Lowest candidate
+		size_t			Hi = (Diag < NA) ? Diag : NA;												//  Highest candidate
+		size_t			Mid = 0;																	//  Probe
+		int				TieLimit = MergeeFirst ? -1 : 0;											//  Highest compare result taken from the first array
+
+		//  Find the lowest count where the next first array record does not precede the last second array record
+		while (Lo < Hi) {
+			Mid = (Lo + Hi) / 2;
+			if (compareKeys<C>(pA[Mid], pB[Diag - Mid - 1], KL) <= TieLimit) Lo = Mid + 1;
+			else Hi = Mid;
+		}
 
-	//*******************************************************************************************************************
-	//*                                                                                                                 *
-	//*   Private Functions                                                                                             *
-	//*                                                                                                                 *
-	//*******************************************************************************************************************
+		//  Return the count
+		return Lo;
+	}
 
-	//  addKeyToStore
+	//  mergeRange
 	//
-	//  Returns a pointer to the copy of the passed key in the keystore
+	//  Merges two sorted ranges of records into the passed output
 	//
 	//  PARAMETERS:
-	//
-	//		char*			-		Const pointer to the key to be added to the keystore
+	// 
+	//		T*					-		Const pointer to the first (target) range
+	//		size_t				-		Number of records in the first range
+	//		T*					-		Const pointer to the second (mergee) range
+	//		size_t				-		Number of records in the second range
+	//		T*					-		Pointer to the output
+	//		bool				-		true if mergee records are placed ahead of target records on identical keys
 	//
 	//  RETURNS:
-	// 
-	//		char*			-		Pointer to the copy of the key in the keystore
 	//
 	//  NOTES:
+	//
+	//	1.	The leading run of the first range that precedes the second range is located by galloping and block copied.
+	//	2.	When either range wins MinGallop consecutive comparisons the remainder of its run is located by galloping
+	//		and block copied, the record by record merge resumes at the end of the run.
+	//	3.	The residue of whichever range remains is block copied.
+	//	4.	The record by record merge selects the record and advances the ranges with a mask instead of a conditional
+	//		select (compiled to a jump that is mispredicted half of the time on random keys). For record types holding
+	//		a key prefix the key tails are only compared on identical prefixes.
+	//	5.	Record types holding a key prefix are merged in blocks by the vector prefix merge kernel for the kernel
+	//		level (see CPUDispatch::mergePfxAVX2()). The kernel returns on a prefix tie, on a run from one range and
+	//		near the end of either range, the merge then continues record by record for MinGallop records (or a
+	//		gallop) before the kernel is resumed. When the kernel merges nothing (runs of identical prefixes) the
+	//		record by record stretch is doubled on each call, up to MaxKernelBackoff records, so that inputs the
+	//		kernel cannot merge cost little more than the scalar merge. At the scalar kernel level every record is
+	//		merged record by record.
 	//  
 
-	char* addKeyToStore(const char* pKey) {
-		char* pSKey = nullptr;														//  Pointer to key in the store
+	void	mergeRange(const T* pA, size_t NA, const T* pB, size_t NB, T* pOut, bool MergeeFirst) {
+		const T*		pAEnd = pA + NA;															//  End of the first range
+		const T*		pBEnd = pB + NB;															//  End of the second range
+		int				TieLimit = MergeeFirst ? -1 : 0;											//  Highest compare result taken from the first range
+		const T*		pSrc = nullptr;																//  Record taken
+		uintptr_t		Mask = 0;																	//  Selection mask (all ones takes the first range)
+		bool			TakeA = false;																//  Record is taken from the first range
+		bool			LastA = false;																//  Previous record was taken from the first range
+		size_t			Wins = 0;																	//  Consecutive records taken from the same range
+		size_t			Run = 0;																	//  Length of a galloped run
+		size_t			PfxOff = 0;																	//  Offset of the key prefix in a record
+		CPUDispatch::PfxMerger	pMerger = getPrefixMerger<T>(PfxOff);								//  Vector merge kernel (nullptr = none)
+		size_t			Resume = 0;																	//  Records to merge before the kernel resumes
+		size_t			Backoff = MinGallop;														//  Records merged after an unproductive kernel call
+		const char*		pANext = nullptr;															//  Next record of the first range (kernel)
+		const char*		pBNext = nullptr;															//  Next record of the second range (kernel)
+		char*			pOutNext = nullptr;															//  Next output record (kernel)
+
+		//  Block copy the leading run of the first range that precedes the second range
+		if (pB < pBEnd) {
+			Run = gallopFirst(pA, NA, *pB, TieLimit);
+			if (Run > 0) {
+				memcpy(pOut, pA, Run * sizeof(T));
+				pOut += Run;
+				pA += Run;
+			}
+		}
 
-		//  Check that there is enough free space in the last arena of the keystore
-		if (pLastArena->FreeSpace < KL) {
-			//  Add an additional arena to the keystore
-			pLastArena->pNext = (Arena*)malloc(ArenaSize);
-			if (pLastArena->pNext == nullptr) return nullptr;
-			pLastArena->pNext->pNext = nullptr;
-			pLastArena->pNext->FreeSpace = ArenaSize - sizeof(Arena);
-			pLastArena->pNext->pKey = (char*)(pLastArena->pNext + 1);
-			pLastArena = pLastArena->pNext;
+		//  Merge until either range is exhausted, galloping when one range is winning consistently
+		while ((pA < pAEnd) && (pB < pBEnd)) {
+
+			//  Merge blocks of records with the vector kernel
+			if ((pMerger != nullptr) && (Resume == 0)) {
+				pANext = (const char*) pA;
+				pBNext = (const char*) pB;
+				pOutNext = (char*) pOut;
+				pMerger(pANext, (const char*) pAEnd, pBNext, (const char*) pBEnd, pOutNext, sizeof(T), PfxOff);
+				if (pOutNext != (char*) pOut) Backoff = MinGallop;
+				else if (Backoff < MaxKernelBackoff) Backoff = 2 * Backoff;
+				pA = (const T*) pANext;
+				pB = (const T*) pBNext;
+				pOut = (T*) pOutNext;
+				Resume = Backoff;
+				Wins = 0;
+				continue;
+			}
+			if (Resume > 0) Resume--;
+
+			//  Merge the next record
+			TakeA = keyPrecedes<C>(*pA, *pB, KL, TieLimit);
+			Mask = uintptr_t(0) - uintptr_t(TakeA);
+			pSrc = (const T*) (uintptr_t(pB) ^ ((uintptr_t(pA) ^ uintptr_t(pB)) & Mask));
+			*pOut++ = *pSrc;
+			pA += TakeA;
+			pB += !TakeA;
+			Wins = (TakeA == LastA) ? Wins + 1 : 1;
+			LastA = TakeA;
+			if (Wins >= MinGallop) {
+				if (TakeA) {
+					Run = gallopFirst(pA, pAEnd - pA, *pB, TieLimit);
+					memcpy(pOut, pA, Run * sizeof(T));
+					pA += Run;
+				}
+				else {
+					Run = gallopSecond(pB, pBEnd - pB, *pA, TieLimit);
+					memcpy(pOut, pB, Run * sizeof(T));
+					pB += Run;
+				}
+				pOut += Run;
+				Wins = 0;
+			}
 		}
 
-		//  Copy the key into the keystore and update the arena header
-		pSKey = pLastArena->pKey;
-		memcpy(pLastArena->pKey, pKey, KL);
-		pLastArena->FreeSpace -= KL;
-		pLastArena->pKey += KL;
+		//  Copy the residue of whichever range remains
+		if (pA < pAEnd) memcpy(pOut, pA, (pAEnd - pA) * sizeof(T));
+		if (pB < pBEnd) memcpy(pOut, pB, (pBEnd - pB) * sizeof(T));
 
-		//  Return pointer to the key
-		return pSKey;
+		//  Return to caller
+		return;
 	}
 
-	//  expandArray
+	//  gallopFirst
 	//
-	//  Expands the Sort Records Array (SRA) to accomodate additional records
+	//  Returns the length of the leading run of the first (target) range that is placed ahead of the passed record
 	//
 	//  PARAMETERS:
+	// 
+	//		T*					-		Const pointer to the first (target) range
+	//		size_t				-		Number of records in the range
+	//		T&					-		Const reference to the next record of the second (mergee) range
+	//		int					-		Highest compare result taken from the first range
 	//
 	//  RETURNS:
 	//
+	//		size_t				-		Number of leading records of the range that precede the passed record
+	//
 	//  NOTES:
+	//
+	//	1.	The run end is bracketed by probing at exponentially increasing distances (1, 2, 4, ...) and then located
+	//		by a binary search of the bracket, the cost is logarithmic in the length of the run not of the range.
 	//  
 
-	void	expandArray() {
-		size_t		Extra = 0;																//  Additional records
-		T* pNewSRA = nullptr;														//  Pointer to the new Sort Records Array (SRA)
-		size_t		NewLo = 0;																//  New Low index
+	size_t	gallopFirst(const T* pA, size_t NA, const T& Key, int TieLimit) {
+		size_t			Lo = 0;																		//  Records known to precede the key
+		size_t			Hi = 1;																		//  Probe distance
+		size_t			Mid = 0;																	//  Probe
 
-		//  Determine the capacity increment
-		if (SRALo == 0) Extra += SRAInc;
-		if (SRAHi == (SRASize - 1)) Extra += SRAInc;
-		if (Extra == 0) return;
-
-		//  Reallocate the sort records array with the required capacity
-		pNewSRA = (T*)realloc(pSRA, (SRASize + Extra) * sizeof(T));
-		if (pNewSRA == nullptr) return;
+		//  Bracket the end of the run
+		while ((Hi <= NA) && (compareKeys<C>(pA[Hi - 1], Key, KL) <= TieLimit)) {
+			Lo = Hi;
+			Hi = Hi * 2;
+		}
+		Hi = (Hi <= NA) ? Hi - 1 : NA;
 
-		//  Determine the new index of the low record, if it must be adjusted
-		if (SRALo == 0) {
-			NewLo = SRAInc;
-			memmove(&pNewSRA[NewLo], &pNewSRA[SRALo], SRANum * sizeof(T));
+		//  Binary search the bracket
+		while (Lo < Hi) {
+			Mid = (Lo + Hi) / 2;
+			if (compareKeys<C>(pA[Mid], Key, KL) <= TieLimit) Lo = Mid + 1;
+			else Hi = Mid;
 		}
-		else NewLo = SRALo;
 
-		//  Update the Hi and Lo indexes
-		SRALo = NewLo;
-		SRAHi = NewLo + (SRANum - 1);
+		//  Return the run length
+		return Lo;
+	}
 
-		//  Update the array
-		pSRA = pNewSRA;
-		SRASize += Extra;
+	//  gallopSecond
+	//
+	//  Returns the length of the leading run of the second (mergee) range that is placed ahead of the passed record
+	//
+	//  PARAMETERS:
+	// 
+	//		T*					-		Const pointer to the second (mergee) range
+	//		size_t				-		Number of records in the range
+	//		T&					-		Const reference to the next record of the first (target) range
+	//		int					-		Highest compare result taken from the first range
+	//
+	//  RETURNS:
+	//
+	//		size_t				-		Number of leading records of the range that precede the passed record
+	//
+	//  NOTES:
+	//
+	//	1.	The mirror of gallopFirst(), a mergee record precedes the target record when the target record would not
+	//		be taken ahead of it.
+	//  
 
-		//  Update the increment size
-		if (SRAInc < size_t(64 * 1024)) SRAInc = SRAInc * 2;
+	size_t	gallopSecond(const T* pB, size_t NB, const T& Key, int TieLimit) {
+		size_t			Lo = 0;																		//  Records known to precede the key
+		size_t			Hi = 1;																		//  Probe distance
+		size_t			Mid = 0;																	//  Probe
 
-		//  Return to caller
-		return;
+		//  Bracket the end of the run
+		while ((Hi <= NB) && (compareKeys<C>(Key, pB[Hi - 1], KL) > TieLimit)) {
+			Lo = Hi;
+			Hi = Hi * 2;
+		}
+		Hi = (Hi <= NB) ? Hi - 1 : NB;
+
+		//  Binary search the bracket
+		while (Lo < Hi) {
+			Mid = (Lo + Hi) / 2;
+			if (compareKeys<C>(Key, pB[Mid], KL) > TieLimit) Lo = Mid + 1;
+			else Hi = Mid;
+		}
+
+		//  Return the run length
+		return Lo;
 	}
 
 	//  mergeSpecialCase
@@ -778,6 +1571,7 @@ private:
 	//  PARAMETERS:
 	// 
 	//		SplitStore*		-		Pointer to the next store 
+	//		bool			-		true if mergee records are placed ahead of target records on identical keys
 	//
 	//  RETURNS:
 	// 
@@ -786,7 +1580,7 @@ private:
 	//  NOTES:
 	//  
 
-	bool	mergeSpecialCase(SplitStore<T>* pNS) {
+	bool	mergeSpecialCase(SplitStore<T, C>* pNS, bool MergeeFirst) {
 		size_t			ACSize = 0;																		//  Arena content size
 
 		//  If not using KeyStore then special case merge not required
@@ -803,7 +1597,7 @@ private:
 			if (ACSize > pLastArena->FreeSpace) return false;
 
 			//  Perform a mergee relocation merge
-			mergeRelocateMergee(pNS);
+			mergeRelocateMergee(pNS, MergeeFirst, false);
 		}
 		else {
 			//  The target is a candidate for relocation - determine if the arena content will fit into the
@@ -812,7 +1606,7 @@ private:
 			if (ACSize > pNS->pLastArena->FreeSpace) return false;
 
 			//  Perform a target relocation merge
-			mergeRelocateTarget(pNS);
+			mergeRelocateTarget(pNS, MergeeFirst);
 		}
 
 		//  Return showing merge was completed by special processing
@@ -822,18 +1616,19 @@ private:
 	//  mergeRelocateTarget
 	//
 	//  Merges the next splitter store into the current one, the target KeyStore will be relocated during this process.
-	//  The function will swap the target and mergee KeyStores and process as a mergee relocation.
+	//  The function will swap the target and mergee KeyStores and process as a relocation of the target keys.
 	//
 	//  PARAMETERS:
 	// 
 	//		SplitStore*			-		Pointer to the next store in the chain
+	//		bool				-		true if mergee records are placed ahead of target records on identical keys
 	//
 	//  RETURNS:
 	//
 	//  NOTES:
 	//  
 
-	void	mergeRelocateTarget(SplitStore<T>* pNS) {
+	void	mergeRelocateTarget(SplitStore<T, C>* pNS, bool MergeeFirst) {
 		Arena* pTemp = nullptr;
 
 		pTemp = pNS->pKeyStore;
@@ -844,23 +1639,26 @@ private:
 		pNS->pLastArena = pLastArena;
 		pLastArena = pTemp;
 
-		return mergeRelocateMergee(pNS);
+		return mergeRelocateMergee(pNS, MergeeFirst, true);
 	}
 
 	//  mergeRelocateMergee
 	//
-	//  Merges the next splitter store into the current one, the mergee KeyStore will be relocated during this process.
+	//  Merges the next splitter store into the current one, the single arena KeyStore of the mergee will be relocated
+	//  into the last arena of the target during this process.
 	//
 	//  PARAMETERS:
 	// 
 	//		SplitStore*			-		Pointer to the next store in the chain
+	//		bool				-		true if mergee records are placed ahead of target records on identical keys
+	//		bool				-		true if the relocated keys belong to the target records (KeyStores swapped)
 	//
 	//  RETURNS:
 	//
 	//  NOTES:
 	//  
 
-	void	mergeRelocateMergee(SplitStore<T>* pNS) {
+	void	mergeRelocateMergee(SplitStore<T, C>* pNS, bool MergeeFirst, bool TargetKeys) {
 		char* pRFK = nullptr;																		//  Pointer to the first key to be relocate
 		char* pRelBase = nullptr;																	//  Base address in the target arena
 		size_t			RelSize = 0;																		//  Size of keys to be relocated
@@ -870,6 +1668,7 @@ private:
 		T* pNewSRA = nullptr;																	//  New Sort Record Array (SRA)
 		size_t			OldTEnt = SRALo;																	//  Next candidate (this)
 		size_t			OldMEnt = pNS->SRALo;																//  Next candidate (merge)
+		int				TieLimit = MergeeFirst ? -1 : 0;													//  Highest compare result taken from this
 
 		//  Calculate first key to relocate and relocation size 
 		pRFK = (char*)(pNS->pLastArena + 1);
@@ -882,12 +1681,12 @@ private:
 		pLastArena->pKey += RelSize;
 
 		//
-		//  The merge process is now performed as usual BUT any keys from the mergee will be updated to point to the key in the target keystore.
+		//  The merge process is now performed as usual BUT any keys from the relocated arena will be updated to point to the key in the target keystore.
 		//  pNewKey = (pOldKey - pRFK) + pRelBase - i.e. Offset + Base
 		//
 
 		//  Allocate a new Sorted Record Array (SRA)
-		pNewSRA = (T*)malloc(NewCapacity * sizeof(T));
+		pNewSRA = acquireSRA(NewCapacity);
 		if (pNewSRA == nullptr) {
 			std::cerr << "ERROR: SplitStore::mergeRelocateMergee() failed to allocate a new SRA buffer (" << (NewCapacity * sizeof(T)) << " bytes)." << std::endl;
 			//
@@ -899,32 +1698,21 @@ private:
 		}
 
 		//
-		//  Merge Phase 1 - Copy from the old current array into the new array until the current key > merge key
-		//  No relocation is needed
-		//
-
-		while (memcmp(pSRA[OldTEnt].pKey, pNS->pSRA[OldMEnt].pKey, KL) <= 0) {
-			memcpy(&pNewSRA[NewEnt], &pSRA[OldTEnt], sizeof(T));
-			NewEnt++;
-			OldTEnt++;
-		}
-
-		//
-		//  Merge Phase 2 - Copy from the lowest key of Current or merge until the merge array is exhausted
-		//  Relocate keys from the mergee
+		//  Merge Phase 1 & 2 - Copy from the lowest key of Current or merge until the merge array is exhausted
+		//  Relocate keys from the relocated arena
 		//
 
 		while (OldMEnt <= pNS->SRAHi) {
-			if (memcmp(pSRA[OldTEnt].pKey, pNS->pSRA[OldMEnt].pKey, KL) <= 0) {
+			if ((OldTEnt <= SRAHi) && (compareKeys<C>(pSRA[OldTEnt], pNS->pSRA[OldMEnt], KL) <= TieLimit)) {
 				//  Copy from the current array into the new array
 				memcpy(&pNewSRA[NewEnt], &pSRA[OldTEnt], sizeof(T));
+				if (TargetKeys) setKey(pNewSRA[NewEnt], (getKey(pNewSRA[NewEnt]) - pRFK) + pRelBase);
 				OldTEnt++;
 			}
 			else {
 				//  Copy from the merge array into the new array
 				memcpy(&pNewSRA[NewEnt], &pNS->pSRA[OldMEnt], sizeof(T));
-				//  Relocate key
-				pNewSRA[NewEnt].pKey = (((char*)pNewSRA[NewEnt].pKey) - pRFK) + pRelBase;
+				if (!TargetKeys) setKey(pNewSRA[NewEnt], (getKey(pNewSRA[NewEnt]) - pRFK) + pRelBase);
 				OldMEnt++;
 			}
 			NewEnt++;
@@ -937,6 +1725,7 @@ private:
 		while (OldTEnt <= SRAHi) {
 			//  Copy from current into the new array
 			memcpy(&pNewSRA[NewEnt], &pSRA[OldTEnt], sizeof(T));
+			if (TargetKeys) setKey(pNewSRA[NewEnt], (getKey(pNewSRA[NewEnt]) - pRFK) + pRelBase);
 			OldTEnt++;
 			NewEnt++;
 		}
@@ -945,7 +1734,7 @@ private:
 		//  Update the current splitter with the new array
 		//
 
-		free(pSRA);
+		releaseSRA(pSRA);
 		pSRA = pNewSRA;
 		SRASize = NewCapacity;
 		SRANum += pNS->SRANum;
@@ -3,7 +3,7 @@
 //*																													*
 //*   File:       Splitter.h																						*
 //*   Suite:      Experimental Algorithms																			*
-//*   Version:    1.17.0	(Build: 20)																				*
+//*   Version:    1.36.0	(Build: 40)																				*
 //*   Author:     Ian Tree/HMNL																						*
 //*																													*
 //*   Copyright 2017 - 2026 Ian J. Tree																				*
@@ -14,6 +14,8 @@
 //* The template parameter specifies a type for the internal sort records. Internal sort record types MUST contain	*
 //* a member 'pKey' that is a pointer to the key on which the records are to be sorted. It would be expected that	*
 //* the type also holds a reference to the location of the input sort record to which the key refers.				*
+//* The second template parameter is the key comparator policy (see KeyCompare.h), the default compares keys of		*
+//* any length.																										*
 //*																													*
 //*	ALGORITHM:																										*
 //*																													*
@@ -43,6 +45,24 @@
 //*	1.15.0 -	25/08/2023	-	Binary-Chop search of Store Chain													*
 //*	1.16.0 -	16/10/2023	-	Improved PM handling of Worst Case (Tail-Suppression)								*
 //*	1.17.0 -	28/01/2026	-	Include instrumentation package														*
+//*	1.18.0 -	16/10/2026	-	Multi-threaded final merge															*
+//*	1.19.0 -	16/10/2026	-	Merge-path partitioned merges														*
+//*	1.20.0 -	16/10/2026	-	Streamed k-way (loser tree) final merge												*
+//*	1.21.0 -	16/10/2026	-	Ping-pong merge buffers for the final merge											*
+//*	1.22.0 -	16/10/2026	-	Inline key prefix in sort records													*
+//*	1.23.0 -	16/10/2026	-	Comparator policy template parameter												*
+//*	1.24.0 -	16/10/2026	-	Boundary key index for the binary chop												*
+//*	1.25.0 -	16/10/2026	-	Natural run detection with bulk insertion											*
+//*	1.27.0 -	16/10/2026	-	Chunk parallel sort with store adoption												*
+//*	1.28.0 -	16/10/2026	-	Selectable preemptive merge policy													*
+//*	1.29.0 -	16/10/2026	-	Single pass k-way tail suppression													*
+//*	1.30.0 -	16/10/2026	-	Size ordered final merge schedule													*
+//*	1.31.0 -	16/10/2026	-	Background preemptive merge															*
+//*	1.32.0 -	16/10/2026	-	Amortised preemptive merge															*
+//*	1.33.0 -	16/10/2026	-	Size tiered store compaction														*
+//*	1.34.0 -	16/10/2026	-	Slab pool allocation of stores and initial SRAs										*
+//*	1.35.0 -	16/10/2026	-	Segmented double ended SRA storage													*
+//*	1.36.0 -	16/10/2026	-	Finger search of the store chain													*
 //*																													*
 //*******************************************************************************************************************/
 
@@ -52,12 +72,17 @@
 //  Application headers
 #include	"IStats.h"																		//  Instrumentation
 #include	"SplitStore.h"																	//  Splitter Store
+#include	"WorkerPool.h"																	//  Worker thread pool
+#include	"LoserTree.h"																	//  K-way merge tournament tree
+#include	"MergeBuffers.h"																//  Merge target buffer manager
+#include	"PMPolicy.h"																	//  Preemptive merge policy
+#include	"SlabPool.h"																	//  Slab pool allocator
 
 //
 //  Splitter Class Template
 //
 
-template <typename T>
+template <typename T, typename C = VarKeyCompare>
 class Splitter {
 public:
 
@@ -353,7 +378,7 @@ public:
 	typedef struct StoreChain {
 		size_t			StoreCount;													//  Count of stores in the chain
 		size_t			StoreCap;													//  Store capacity
-		SplitStore<T>* Store[4096];												//  Array of pointers to the stores
+		SplitStore<T, C>* Store[4096];												//  Array of pointers to the stores
 	} StoreChain;
 
 	//*******************************************************************************************************************
@@ -377,7 +402,11 @@ public:
 	//  NOTES:
 	//
 
-	Splitter<T>(T& IRec, size_t KeyLen, IStats& Ins) : KL(KeyLen), Stats(Ins) {
+	Splitter(T& IRec, size_t KeyLen, IStats& Ins) : KL(KeyLen), KSASize(0), Stats(Ins) {
+
+		//  Initialise the pools for the stores and their initial SRAs and segments
+		pStorePool = new SlabPool(SplitStore<T, C>::getPoolSlotSize());
+		pSRAPool = new SlabPool(256 * sizeof(T));
 
 		//  Initialise the splitStore chain
 		pStoreChain = (StoreChain*) malloc((2 * sizeof(size_t)) + (4096 * sizeof(void*)));
@@ -389,15 +418,41 @@ public:
 		else {
 			memset(pStoreChain, 0, (2 * sizeof(size_t)) + (4096 * sizeof(void*)));
 			pStoreChain->StoreCap = 4096;
-			pStoreChain->Store[0] = new SplitStore<T>(IRec, KeyLen, Stats);
+			pStoreChain->Store[0] = new (pStorePool) SplitStore<T, C>(IRec, KeyLen, Stats, pSRAPool);
 			pStoreChain->StoreCount = 1;
 			Stats.newKey();
 		}
 
+		//  Initialise the boundary key index
+		pBoundMem = nullptr;
+		pLoBound = pHiBound = nullptr;
+		BoundCap = 0;
+		expandBoundaryIndex(pStoreChain->StoreCap);
+		setBoundaries(0);
+		LastStore = 0;
+
 		//  Initialise the Preemptive Merge controls
 		RecNo = 1;
-		MaxStores = 100;
-		MaxSInc = 25;
+		MaxStores = PMP.MaxStores;
+		BGDone = false;
+		pBGStores = nullptr;
+		BGCount = BGTarget = 0;
+		BGStable = false;
+		BGAscending = true;
+		BGMergeTime = xymorg::MICROSECONDS(0);
+		pDeferred = nullptr;
+		DeferCount = DeferCap = 0;
+		DeferFirst = DeferHead = 0;
+		Amortising = Replaying = BGStaged = false;
+
+		//  Final merge is single threaded until requested otherwise
+		pMergePool = nullptr;
+		MergePathMin = 1000000;
+		SizedFM = false;
+		pStreamFM = nullptr;
+
+		//  Stores are located by the binary chop until requested otherwise
+		FingerSearch = false;
 
 		//  Return to caller
 		return;
@@ -419,7 +474,11 @@ public:
 	//  NOTES:
 	//
 
-	Splitter<T>(T& IRec, size_t KeyLen, size_t KSASizeKB, IStats& Ins) : KL(KeyLen), Stats(Ins) {
+	Splitter(T& IRec, size_t KeyLen, size_t KSASizeKB, IStats& Ins) : KL(KeyLen), KSASize(KSASizeKB), Stats(Ins) {
+
+		//  Initialise the pools for the stores and their initial SRAs and segments
+		pStorePool = new SlabPool(SplitStore<T, C>::getPoolSlotSize());
+		pSRAPool = new SlabPool(256 * sizeof(T));
 
 		//  Initialise the splitStore chain
 		pStoreChain = (StoreChain*) malloc((2 * sizeof(size_t)) + (4096 * sizeof(void*)));
@@ -431,15 +490,41 @@ public:
 		else {
 			memset(pStoreChain, 0, (2 * sizeof(size_t)) + (4096 * sizeof(void*)));
 			pStoreChain->StoreCap = 4096;
-			pStoreChain->Store[0] = new SplitStore<T>(IRec, KeyLen, KSASizeKB, Stats);
+			pStoreChain->Store[0] = new (pStorePool) SplitStore<T, C>(IRec, KeyLen, KSASizeKB, Stats, pSRAPool);
 			pStoreChain->StoreCount = 1;
 			Stats.newKey();
 		}
 
+		//  Initialise the boundary key index
+		pBoundMem = nullptr;
+		pLoBound = pHiBound = nullptr;
+		BoundCap = 0;
+		expandBoundaryIndex(pStoreChain->StoreCap);
+		setBoundaries(0);
+		LastStore = 0;
+
 		//  Initialise the Preemptive Merge controls
 		RecNo = 1;
-		MaxStores = 100;
-		MaxSInc = 25;
+		MaxStores = PMP.MaxStores;
+		BGDone = false;
+		pBGStores = nullptr;
+		BGCount = BGTarget = 0;
+		BGStable = false;
+		BGAscending = true;
+		BGMergeTime = xymorg::MICROSECONDS(0);
+		pDeferred = nullptr;
+		DeferCount = DeferCap = 0;
+		DeferFirst = DeferHead = 0;
+		Amortising = Replaying = BGStaged = false;
+
+		//  Final merge is single threaded until requested otherwise
+		pMergePool = nullptr;
+		MergePathMin = 1000000;
+		SizedFM = false;
+		pStreamFM = nullptr;
+
+		//  Stores are located by the binary chop until requested otherwise
+		FingerSearch = false;
 
 		//  Return to caller
 		return;
@@ -464,14 +549,42 @@ public:
 
 	~Splitter() {
 
+		//  Dismiss any background merge and the deferred keys
+		if (pBGStores != nullptr) {
+			if (BGThread.joinable()) BGThread.join();
+			for (size_t sIndex = 0; sIndex < BGCount; sIndex++) delete pBGStores[sIndex];
+			free(pBGStores);
+		}
+		pBGStores = nullptr;
+		if (pDeferred != nullptr) free(pDeferred);
+		pDeferred = nullptr;
+
 		//  Destroy the SplitStore chain (if it exists)
 
 		if (pStoreChain != nullptr) {
 			for (size_t sIndex = 0; sIndex < pStoreChain->StoreCount; sIndex++) delete pStoreChain->Store[sIndex];
-			delete pStoreChain;
+			free(pStoreChain);
 		}
 		pStoreChain = nullptr;
 
+		//  Dismiss the store and SRA pools, every store has been destroyed
+		if (pStorePool != nullptr) delete pStorePool;
+		if (pSRAPool != nullptr) delete pSRAPool;
+		pStorePool = pSRAPool = nullptr;
+
+		//  Destroy the boundary key index
+		if (pBoundMem != nullptr) free(pBoundMem);
+		pBoundMem = nullptr;
+		pLoBound = pHiBound = nullptr;
+
+		//  Destroy the streamed final merge (if it exists)
+		if (pStreamFM != nullptr) delete pStreamFM;
+		pStreamFM = nullptr;
+
+		//  Destroy the final merge worker pool (if it exists)
+		if (pMergePool != nullptr) delete pMergePool;
+		pMergePool = nullptr;
+
 		//  Return to caller
 		return;
 	}
@@ -510,6 +623,10 @@ public:
 		bool		Without = false;														//  Within/Without control
 		bool		Below = false;															//  Above or below control
 		bool		OtherWithout = false;													//  Other Within/Without control
+		uint64_t	NewPfx = getKeyPrefix(NewSR, KL);										//  Key prefix of the new record
+
+		//  While an amortised PM is in progress perform its next quantum, the key may be deferred
+		if (Amortising && !Replaying && amortisePM(NewSR, NewPfx, false)) return;
 
 		//  Increment the record number
 		RecNo++;
@@ -524,8 +641,9 @@ public:
 #ifdef INSTRUMENTED
 		Stats.Compares++;
 #endif
-		if (memcmp(NewSR.pKey, pStoreChain->Store[CurrentStore]->pSRA[pStoreChain->Store[CurrentStore]->SRALo].pKey, KL) <= 0) {
+		if (compareLowBound(NewSR, NewPfx, CurrentStore) <= 0) {
 			pStoreChain->Store[CurrentStore]->addLowKey(NewSR);
+			setLowBound(CurrentStore, NewPfx);
 #ifdef INSTRUMENTED
 			Stats.LoHits++;
 			//  Increment the new key counter - if this triggered a stats reporting interval then do the pile-up reporting
@@ -545,8 +663,9 @@ public:
 #ifdef INSTRUMENTED
 		Stats.Compares++;
 #endif
-		if (memcmp(NewSR.pKey, pStoreChain->Store[CurrentStore]->pSRA[pStoreChain->Store[CurrentStore]->SRAHi].pKey, KL) >= 0) {
+		if (compareHighBound(NewSR, NewPfx, CurrentStore) >= 0) {
 			pStoreChain->Store[CurrentStore]->addHighKey(NewSR);
+			setHighBound(CurrentStore, NewPfx);
 #ifdef INSTRUMENTED
 			Stats.HiHits++;
 			//  Increment the new key counter - if this triggered a stats reporting interval then do the pile-up reporting
@@ -568,33 +687,39 @@ public:
 #ifdef INSTRUMENTED
 		Stats.Compares++;
 #endif
-		if (memcmp(NewSR.pKey, pStoreChain->Store[CurrentStore]->pSRA[pStoreChain->Store[CurrentStore]->SRALo].pKey, KL) > 0) {
+		if (compareLowBound(NewSR, NewPfx, CurrentStore) > 0) {
 #ifdef INSTRUMENTED
 			Stats.Compares++;
 #endif
-			if (memcmp(NewSR.pKey, pStoreChain->Store[CurrentStore]->pSRA[pStoreChain->Store[CurrentStore]->SRAHi].pKey, KL) < 0) {
+			if (compareHighBound(NewSR, NewPfx, CurrentStore) < 0) {
 
+				//  The key is deferred while the tail of the chain is being merged in the background
+				if (pBGStores != nullptr) {
+					deferKey(NewSR);
+					return;
+				}
 #ifdef INSTRUMENTED
 				Stats.NewStores++;
 				Stats.Stores++;
 #endif
 				//  A new store must be added to the array to accomodate the key
-				pStoreChain->Store[pStoreChain->StoreCount] = new SplitStore<T>(NewSR, KL, Stats);
+				pStoreChain->Store[pStoreChain->StoreCount] = new (pStorePool) SplitStore<T, C>(NewSR, KL, Stats, pSRAPool);
+				setBounds(pStoreChain->StoreCount, NewPfx);
 				pStoreChain->StoreCount++;
 
 				//  Test for trigger of a preemptive merge if the store count has exceeded the maximum
-				if (PMEnabled && (pStoreChain->StoreCount > MaxStores)) {
-					//std::cout << "TRACE: Tail Suppression triggered at record: " << RecNo << ", store: " << pStoreChain->StoreCount << "." << std::endl;
-					//  Perform the preemptive merge (suppression of tail)
+				if (PMEnabled && ((pStoreChain->StoreCount > MaxStores) || isTierFull())) {
+					//std::cout << "TRACE: Preemptive merge triggered at record: " << RecNo << ", store: " << pStoreChain->StoreCount << "." << std::endl;
+					//  Perform the preemptive merge selected by the policy
 #ifdef INSTRUMENTED
 					Stats.PMs++;
 #endif
-					suppressTail();
+					preemptiveMerge(false, true);
 					//  Recompute the Maximum number of stores
-					MaxStores = computeMaxStores(MaxStores, RecNo, MaxSInc);
+					MaxStores = PMP.getTrigger(MaxStores, RecNo, getStoreCost());
 
 					//  Check that there is capacity in the StoreChain structure to accomodate the maximum number of stores
-					if (MaxStores > pStoreChain->StoreCap) expandStoreChain();
+					while (MaxStores > pStoreChain->StoreCap) expandStoreChain();
 				}
 				else {
 					if (!PMEnabled) {
@@ -616,6 +741,9 @@ public:
 			}
 		}
 
+		//  Search outwards from the store that received the last key when finger search is enabled
+		if (FingerSearch && fingerSearch(NewSR, NewPfx, false, false)) return;
+
 		//
 		//  Setup to perform a Binary Chop search of the Store Chain beginning at the Mid-Point.
 		//
@@ -630,12 +758,12 @@ public:
 #ifdef INSTRUMENTED
 			Stats.Compares++;
 #endif
-			if (memcmp(NewSR.pKey, pStoreChain->Store[CurrentStore]->pSRA[pStoreChain->Store[CurrentStore]->SRALo].pKey, KL) > 0) {
+			if (compareLowBound(NewSR, NewPfx, CurrentStore) > 0) {
 				Below = false;
 #ifdef INSTRUMENTED
 				Stats.Compares++;
 #endif
-				if (memcmp(NewSR.pKey, pStoreChain->Store[CurrentStore]->pSRA[pStoreChain->Store[CurrentStore]->SRAHi].pKey, KL) < 0) Without = false;
+				if (compareHighBound(NewSR, NewPfx, CurrentStore) < 0) Without = false;
 				else Without = true;
 			}
 			else Without = true;
@@ -647,11 +775,11 @@ public:
 #ifdef INSTRUMENTED
 					Stats.Compares++;
 #endif
-					if (memcmp(NewSR.pKey, pStoreChain->Store[CurrentStore - 1]->pSRA[pStoreChain->Store[CurrentStore - 1]->SRALo].pKey, KL) > 0) {
+					if (compareLowBound(NewSR, NewPfx, CurrentStore - 1) > 0) {
 #ifdef INSTRUMENTED
 						Stats.Compares++;
 #endif
-						if (memcmp(NewSR.pKey, pStoreChain->Store[CurrentStore - 1]->pSRA[pStoreChain->Store[CurrentStore - 1]->SRAHi].pKey, KL) < 0) OtherWithout = false;
+						if (compareHighBound(NewSR, NewPfx, CurrentStore - 1) < 0) OtherWithout = false;
 						else OtherWithout = true;
 					}
 					else OtherWithout = true;
@@ -660,6 +788,8 @@ public:
 				if (!OtherWithout) {
 					if (Below) pStoreChain->Store[CurrentStore]->addLowKey(NewSR);
 					else pStoreChain->Store[CurrentStore]->addHighKey(NewSR);
+					if (Below) setLowBound(CurrentStore, NewPfx);
+					else setHighBound(CurrentStore, NewPfx);
 #ifdef INSTRUMENTED
 					if (Below) Stats.LoHits++;
 					else Stats.HiHits++;
@@ -686,12 +816,12 @@ public:
 #ifdef INSTRUMENTED
 				Stats.Compares++;
 #endif
-				if (memcmp(NewSR.pKey, pStoreChain->Store[CurrentStore + 1]->pSRA[pStoreChain->Store[CurrentStore + 1]->SRALo].pKey, KL) > 0) {
+				if (compareLowBound(NewSR, NewPfx, CurrentStore + 1) > 0) {
 					Below = false;
 #ifdef INSTRUMENTED
 					Stats.Compares++;
 #endif
-					if (memcmp(NewSR.pKey, pStoreChain->Store[CurrentStore + 1]->pSRA[pStoreChain->Store[CurrentStore + 1]->SRAHi].pKey, KL) < 0) OtherWithout = false;
+					if (compareHighBound(NewSR, NewPfx, CurrentStore + 1) < 0) OtherWithout = false;
 					else OtherWithout = true;
 				}
 				else OtherWithout = true;
@@ -700,6 +830,8 @@ public:
 				if (OtherWithout) {
 					if (Below) pStoreChain->Store[CurrentStore + 1]->addLowKey(NewSR);
 					else pStoreChain->Store[CurrentStore + 1]->addHighKey(NewSR);
+					if (Below) setLowBound(CurrentStore + 1, NewPfx);
+					else setHighBound(CurrentStore + 1, NewPfx);
 #ifdef INSTRUMENTED
 					if (Below) Stats.LoHits++;
 					else Stats.HiHits++;
@@ -745,6 +877,7 @@ public:
 		bool		Without = false;														//  Within/Without control
 		bool		Below = false;															//  Above or below control
 		bool		OtherWithout = false;													//  Other Within/Without control
+		uint64_t	NewPfx = getKeyPrefix(NewSR, KL);										//  Key prefix of the new record
 
 		//  Increment the record number
 		RecNo++;
@@ -760,8 +893,9 @@ public:
 #ifdef INSTRUMENTED
 		Stats.Compares++;
 #endif
-		if (memcmp(NewSR.pKey, pStoreChain->Store[CurrentStore]->pSRA[pStoreChain->Store[CurrentStore]->SRALo].pKey, KL) <= 0) {
+		if (compareLowBound(NewSR, NewPfx, CurrentStore) <= 0) {
 			pStoreChain->Store[CurrentStore]->addLowExternalKey(NewSR);
+			setLowBound(CurrentStore, NewPfx);
 #ifdef INSTRUMENTED
 			Stats.LoHits++;
 			//  Increment the new key counter - if this triggered a stats reporting interval then do the pile-up reporting
@@ -781,8 +915,9 @@ public:
 #ifdef INSTRUMENTED
 		Stats.Compares++;
 #endif
-		if (memcmp(NewSR.pKey, pStoreChain->Store[CurrentStore]->pSRA[pStoreChain->Store[CurrentStore]->SRAHi].pKey, KL) >= 0) {
+		if (compareHighBound(NewSR, NewPfx, CurrentStore) >= 0) {
 			pStoreChain->Store[CurrentStore]->addHighExternalKey(NewSR);
+			setHighBound(CurrentStore, NewPfx);
 #ifdef INSTRUMENTED
 			Stats.HiHits++;
 			//  Increment the new key counter - if this triggered a stats reporting interval then do the pile-up reporting
@@ -804,32 +939,33 @@ public:
 #ifdef INSTRUMENTED
 		Stats.Compares++;
 #endif
-		if (memcmp(NewSR.pKey, pStoreChain->Store[CurrentStore]->pSRA[pStoreChain->Store[CurrentStore]->SRALo].pKey, KL) > 0) {
+		if (compareLowBound(NewSR, NewPfx, CurrentStore) > 0) {
 #ifdef INSTRUMENTED
 			Stats.Compares++;
 #endif
-			if (memcmp(NewSR.pKey, pStoreChain->Store[CurrentStore]->pSRA[pStoreChain->Store[CurrentStore]->SRAHi].pKey, KL) < 0) {
+			if (compareHighBound(NewSR, NewPfx, CurrentStore) < 0) {
 
 				//  A new store must be added to the array to accomodate the key
 #ifdef INSTRUMENTED
 				Stats.NewStores++;
 				Stats.Stores++;
 #endif
-				pStoreChain->Store[pStoreChain->StoreCount] = new SplitStore<T>(NewSR, KL, Stats);
+				pStoreChain->Store[pStoreChain->StoreCount] = new (pStorePool) SplitStore<T, C>(NewSR, KL, KSASize, Stats, pSRAPool);
+				setBounds(pStoreChain->StoreCount, NewPfx);
 				pStoreChain->StoreCount++;
 
 				//  Test for trigger of a preemptive merge if the store count has exceeded the maximum
-				if (PMEnabled && (pStoreChain->StoreCount > MaxStores)) {
+				if (PMEnabled && ((pStoreChain->StoreCount > MaxStores) || isTierFull())) {
 					//  Perform the preemptive merge
 #ifdef INSTRUMENTED
 					Stats.PMs++;
 #endif
-					suppressTail();
+					preemptiveMerge(false, true);
 					//  Recompute the Maximum number of stores
-					MaxStores = computeMaxStores(MaxStores, RecNo, MaxSInc);
+					MaxStores = PMP.getTrigger(MaxStores, RecNo, getStoreCost());
 
 					//  Check that there is capacity in the StoreChain structure to accomodate the maximum number of stores
-					if (MaxStores > pStoreChain->StoreCap) expandStoreChain();
+					while (MaxStores > pStoreChain->StoreCap) expandStoreChain();
 				}
 				else {
 					if (!PMEnabled) {
@@ -851,6 +987,9 @@ public:
 			}
 		}
 
+		//  Search outwards from the store that received the last key when finger search is enabled
+		if (FingerSearch && fingerSearch(NewSR, NewPfx, false, true)) return;
+
 		//
 		//  Setup to perform a Binary Chop search of the Store Chain beginning at the Mid-Point.
 		//
@@ -865,12 +1004,12 @@ public:
 #ifdef INSTRUMENTED
 			Stats.Compares++;
 #endif
-			if (memcmp(NewSR.pKey, pStoreChain->Store[CurrentStore]->pSRA[pStoreChain->Store[CurrentStore]->SRALo].pKey, KL) > 0) {
+			if (compareLowBound(NewSR, NewPfx, CurrentStore) > 0) {
 				Below = false;
 #ifdef INSTRUMENTED
 				Stats.Compares++;
 #endif
-				if (memcmp(NewSR.pKey, pStoreChain->Store[CurrentStore]->pSRA[pStoreChain->Store[CurrentStore]->SRAHi].pKey, KL) < 0) Without = false;
+				if (compareHighBound(NewSR, NewPfx, CurrentStore) < 0) Without = false;
 				else Without = true;
 			}
 			else Without = true;
@@ -880,11 +1019,11 @@ public:
 #ifdef INSTRUMENTED
 				Stats.Compares++;
 #endif
-				if (memcmp(NewSR.pKey, pStoreChain->Store[CurrentStore - 1]->pSRA[pStoreChain->Store[CurrentStore - 1]->SRALo].pKey, KL) > 0) {
+				if (compareLowBound(NewSR, NewPfx, CurrentStore - 1) > 0) {
 #ifdef INSTRUMENTED
 					Stats.Compares++;
 #endif
-					if (memcmp(NewSR.pKey, pStoreChain->Store[CurrentStore - 1]->pSRA[pStoreChain->Store[CurrentStore - 1]->SRAHi].pKey, KL) < 0) OtherWithout = false;
+					if (compareHighBound(NewSR, NewPfx, CurrentStore - 1) < 0) OtherWithout = false;
 					else OtherWithout = true;
 				}
 				else OtherWithout = true;
@@ -893,6 +1032,8 @@ public:
 				if (!OtherWithout) {
 					if (Below) pStoreChain->Store[CurrentStore]->addLowExternalKey(NewSR);
 					else pStoreChain->Store[CurrentStore]->addHighExternalKey(NewSR);
+					if (Below) setLowBound(CurrentStore, NewPfx);
+					else setHighBound(CurrentStore, NewPfx);
 #ifdef INSTRUMENTED
 					if (Below) Stats.LoHits++;
 					else Stats.HiHits++;
@@ -911,7 +1052,7 @@ public:
 
 				//  Move further to the left
 				CurrentStore = CurrentStore - Delta;
-				Delta = Delta / 2;
+				if (Delta > 1) Delta = Delta / 2;
 			}
 			else {
 				//  Moving to the right (higher index) - Test against [CurrentStore + 1]
@@ -919,12 +1060,12 @@ public:
 #ifdef INSTRUMENTED
 				Stats.Compares++;
 #endif
-				if (memcmp(NewSR.pKey, pStoreChain->Store[CurrentStore + 1]->pSRA[pStoreChain->Store[CurrentStore + 1]->SRALo].pKey, KL) > 0) {
+				if (compareLowBound(NewSR, NewPfx, CurrentStore + 1) > 0) {
 					Below = false;
 #ifdef INSTRUMENTED
 					Stats.Compares++;
 #endif
-					if (memcmp(NewSR.pKey, pStoreChain->Store[CurrentStore + 1]->pSRA[pStoreChain->Store[CurrentStore + 1]->SRAHi].pKey, KL) < 0) OtherWithout = false;
+					if (compareHighBound(NewSR, NewPfx, CurrentStore + 1) < 0) OtherWithout = false;
 					else OtherWithout = true;
 				}
 				else OtherWithout = true;
@@ -933,6 +1074,8 @@ public:
 				if (OtherWithout) {
 					if (Below) pStoreChain->Store[CurrentStore + 1]->addLowExternalKey(NewSR);
 					else pStoreChain->Store[CurrentStore + 1]->addHighExternalKey(NewSR);
+					if (Below) setLowBound(CurrentStore + 1, NewPfx);
+					else setHighBound(CurrentStore + 1, NewPfx);
 #ifdef INSTRUMENTED
 					if (Below) Stats.LoHits++;
 					else Stats.HiHits++;
@@ -951,7 +1094,7 @@ public:
 
 				//  Move further to the right
 				CurrentStore = CurrentStore + Delta;
-				Delta = Delta / 2;
+				if (Delta > 1) Delta = Delta / 2;
 			}
 		}
 	}
@@ -984,6 +1127,10 @@ public:
 		bool		Without = false;														//  Within/Without control
 		bool		Below = false;															//  Above or below control
 		bool		OtherWithout = false;													//  Other Within/Without control
+		uint64_t	NewPfx = getKeyPrefix(NewSR, KL);										//  Key prefix of the new record
+
+		//  While an amortised PM is in progress perform its next quantum, the key may be deferred
+		if (Amortising && !Replaying && amortisePM(NewSR, NewPfx, true)) return;
 
 		//  Increment the record number
 		RecNo++;
@@ -999,8 +1146,9 @@ public:
 #ifdef INSTRUMENTED
 		Stats.Compares++;
 #endif
-		if (memcmp(NewSR.pKey, pStoreChain->Store[CurrentStore]->pSRA[pStoreChain->Store[CurrentStore]->SRALo].pKey, KL) < 0) {
+		if (compareLowBound(NewSR, NewPfx, CurrentStore) < 0) {
 			pStoreChain->Store[CurrentStore]->addLowKey(NewSR);
+			setLowBound(CurrentStore, NewPfx);
 #ifdef INSTRUMENTED
 			Stats.LoHits++;
 			//  Increment the new key counter - if this triggered a stats reporting interval then do the pile-up reporting
@@ -1020,8 +1168,9 @@ public:
 #ifdef INSTRUMENTED
 		Stats.Compares++;
 #endif
-		if (memcmp(NewSR.pKey, pStoreChain->Store[CurrentStore]->pSRA[pStoreChain->Store[CurrentStore]->SRAHi].pKey, KL) > 0) {
+		if (compareHighBound(NewSR, NewPfx, CurrentStore) > 0) {
 			pStoreChain->Store[CurrentStore]->addHighKey(NewSR);
+			setHighBound(CurrentStore, NewPfx);
 #ifdef INSTRUMENTED
 			Stats.HiHits++;
 			//  Increment the new key counter - if this triggered a stats reporting interval then do the pile-up reporting
@@ -1043,31 +1192,37 @@ public:
 #ifdef INSTRUMENTED
 		Stats.Compares++;
 #endif
-		if (memcmp(NewSR.pKey, pStoreChain->Store[CurrentStore]->pSRA[pStoreChain->Store[CurrentStore]->SRALo].pKey, KL) >= 0) {
+		if (compareLowBound(NewSR, NewPfx, CurrentStore) >= 0) {
 #ifdef INSTRUMENTED
 			Stats.Compares++;
 #endif
-			if (memcmp(NewSR.pKey, pStoreChain->Store[CurrentStore]->pSRA[pStoreChain->Store[CurrentStore]->SRAHi].pKey, KL) <= 0) {
+			if (compareHighBound(NewSR, NewPfx, CurrentStore) <= 0) {
+				//  The key is deferred while the tail of the chain is being merged in the background
+				if (pBGStores != nullptr) {
+					deferKey(NewSR);
+					return;
+				}
 				//  A new store must be added to the array to accomodate the key
 #ifdef INSTRUMENTED
 				Stats.NewStores++;
 				Stats.Stores++;
 #endif
-				pStoreChain->Store[pStoreChain->StoreCount] = new SplitStore<T>(NewSR, KL, Stats);
+				pStoreChain->Store[pStoreChain->StoreCount] = new (pStorePool) SplitStore<T, C>(NewSR, KL, Stats, pSRAPool);
+				setBounds(pStoreChain->StoreCount, NewPfx);
 				pStoreChain->StoreCount++;
 
 				//  Test for trigger of a preemptive merge if the store count has exceeded the maximum
-				if (PMEnabled && (pStoreChain->StoreCount > MaxStores)) {
-					//  Perform the preemptive merge (suppression of tail)
+				if (PMEnabled && ((pStoreChain->StoreCount > MaxStores) || isTierFull())) {
+					//  Perform the preemptive merge selected by the policy
 #ifdef INSTRUMENTED
 					Stats.PMs++;
 #endif
-					suppressStableTail(Ascending);
+					preemptiveMerge(true, Ascending);
 					//  Recompute the Maximum number of stores
-					MaxStores = computeMaxStores(MaxStores, RecNo, MaxSInc);
+					MaxStores = PMP.getTrigger(MaxStores, RecNo, getStoreCost());
 
 					//  Check that there is capacity in the StoreChain structure to accomodate the maximum number of stores
-					if (MaxStores > pStoreChain->StoreCap) expandStoreChain();
+					while (MaxStores > pStoreChain->StoreCap) expandStoreChain();
 				}
 				else {
 					if (!PMEnabled) {
@@ -1089,6 +1244,9 @@ public:
 			}
 		}
 
+		//  Search outwards from the store that received the last key when finger search is enabled
+		if (FingerSearch && fingerSearch(NewSR, NewPfx, true, false)) return;
+
 		//
 		//  Setup to perform a Binary Chop search of the Store Chain beginning at the Mid-Point.
 		//
@@ -1103,12 +1261,12 @@ public:
 #ifdef INSTRUMENTED
 			Stats.Compares++;
 #endif
-			if (memcmp(NewSR.pKey, pStoreChain->Store[CurrentStore]->pSRA[pStoreChain->Store[CurrentStore]->SRALo].pKey, KL) >= 0) {
+			if (compareLowBound(NewSR, NewPfx, CurrentStore) >= 0) {
 				Below = false;
 #ifdef INSTRUMENTED
 				Stats.Compares++;
 #endif
-				if (memcmp(NewSR.pKey, pStoreChain->Store[CurrentStore]->pSRA[pStoreChain->Store[CurrentStore]->SRAHi].pKey, KL) <= 0) Without = false;
+				if (compareHighBound(NewSR, NewPfx, CurrentStore) <= 0) Without = false;
 				else Without = true;
 			}
 			else Without = true;
@@ -1118,11 +1276,11 @@ public:
 #ifdef INSTRUMENTED
 				Stats.Compares++;
 #endif
-				if (memcmp(NewSR.pKey, pStoreChain->Store[CurrentStore - 1]->pSRA[pStoreChain->Store[CurrentStore - 1]->SRALo].pKey, KL) >= 0) {
+				if (compareLowBound(NewSR, NewPfx, CurrentStore - 1) >= 0) {
 #ifdef INSTRUMENTED
 					Stats.Compares++;
 #endif
-					if (memcmp(NewSR.pKey, pStoreChain->Store[CurrentStore - 1]->pSRA[pStoreChain->Store[CurrentStore - 1]->SRAHi].pKey, KL) <= 0) OtherWithout = false;
+					if (compareHighBound(NewSR, NewPfx, CurrentStore - 1) <= 0) OtherWithout = false;
 					else OtherWithout = true;
 				}
 				else OtherWithout = true;
@@ -1131,6 +1289,8 @@ public:
 				if (!OtherWithout) {
 					if (Below) pStoreChain->Store[CurrentStore]->addLowKey(NewSR);
 					else pStoreChain->Store[CurrentStore]->addHighKey(NewSR);
+					if (Below) setLowBound(CurrentStore, NewPfx);
+					else setHighBound(CurrentStore, NewPfx);
 #ifdef INSTRUMENTED
 					if (Below) Stats.LoHits++;
 					else Stats.HiHits++;
@@ -1149,7 +1309,7 @@ public:
 
 				//  Move further to the left
 				CurrentStore = CurrentStore - Delta;
-				Delta = Delta / 2;
+				if (Delta > 1) Delta = Delta / 2;
 			}
 			else {
 				//  Moving to the right (higher index) - Test against [CurrentStore + 1]
@@ -1157,12 +1317,12 @@ public:
 #ifdef INSTRUMENTED
 				Stats.Compares++;
 #endif
-				if (memcmp(NewSR.pKey, pStoreChain->Store[CurrentStore + 1]->pSRA[pStoreChain->Store[CurrentStore + 1]->SRALo].pKey, KL) >= 0) {
+				if (compareLowBound(NewSR, NewPfx, CurrentStore + 1) >= 0) {
 					Below = false;
 #ifdef INSTRUMENTED
 					Stats.Compares++;
 #endif
-					if (memcmp(NewSR.pKey, pStoreChain->Store[CurrentStore + 1]->pSRA[pStoreChain->Store[CurrentStore + 1]->SRAHi].pKey, KL) <= 0) OtherWithout = false;
+					if (compareHighBound(NewSR, NewPfx, CurrentStore + 1) <= 0) OtherWithout = false;
 					else OtherWithout = true;
 				}
 				else OtherWithout = true;
@@ -1171,6 +1331,8 @@ public:
 				if (OtherWithout) {
 					if (Below) pStoreChain->Store[CurrentStore + 1]->addLowKey(NewSR);
 					else pStoreChain->Store[CurrentStore + 1]->addHighKey(NewSR);
+					if (Below) setLowBound(CurrentStore + 1, NewPfx);
+					else setHighBound(CurrentStore + 1, NewPfx);
 #ifdef INSTRUMENTED
 					if (Below) Stats.LoHits++;
 					else Stats.HiHits++;
@@ -1189,7 +1351,7 @@ public:
 
 				//  Move further to the right
 				CurrentStore = CurrentStore + Delta;
-				Delta = Delta / 2;
+				if (Delta > 1) Delta = Delta / 2;
 			}
 		}
 	}
@@ -1217,6 +1379,7 @@ public:
 		bool		Without = false;														//  Within/Without control
 		bool		Below = false;															//  Above or below control
 		bool		OtherWithout = false;													//  Other Within/Without control
+		uint64_t	NewPfx = getKeyPrefix(NewSR, KL);										//  Key prefix of the new record
 
 		//  Increment the record number
 		RecNo++;
@@ -1232,8 +1395,9 @@ public:
 #ifdef INSTRUMENTED
 		Stats.Compares++;
 #endif
-		if (memcmp(NewSR.pKey, pStoreChain->Store[CurrentStore]->pSRA[pStoreChain->Store[CurrentStore]->SRALo].pKey, KL) < 0) {
+		if (compareLowBound(NewSR, NewPfx, CurrentStore) < 0) {
 			pStoreChain->Store[CurrentStore]->addLowExternalKey(NewSR);
+			setLowBound(CurrentStore, NewPfx);
 #ifdef INSTRUMENTED
 			Stats.LoHits++;
 			//  Increment the new key counter - if this triggered a stats reporting interval then do the pile-up reporting
@@ -1253,8 +1417,9 @@ public:
 #ifdef INSTRUMENTED
 		Stats.Compares++;
 #endif
-		if (memcmp(NewSR.pKey, pStoreChain->Store[CurrentStore]->pSRA[pStoreChain->Store[CurrentStore]->SRAHi].pKey, KL) > 0) {
+		if (compareHighBound(NewSR, NewPfx, CurrentStore) > 0) {
 			pStoreChain->Store[CurrentStore]->addHighExternalKey(NewSR);
+			setHighBound(CurrentStore, NewPfx);
 #ifdef INSTRUMENTED
 			Stats.HiHits++;
 			//  Increment the new key counter - if this triggered a stats reporting interval then do the pile-up reporting
@@ -1276,31 +1441,32 @@ public:
 #ifdef INSTRUMENTED
 		Stats.Compares++;
 #endif
-		if (memcmp(NewSR.pKey, pStoreChain->Store[CurrentStore]->pSRA[pStoreChain->Store[CurrentStore]->SRALo].pKey, KL) >= 0) {
+		if (compareLowBound(NewSR, NewPfx, CurrentStore) >= 0) {
 #ifdef INSTRUMENTED
 			Stats.Compares++;
 #endif
-			if (memcmp(NewSR.pKey, pStoreChain->Store[CurrentStore]->pSRA[pStoreChain->Store[CurrentStore]->SRAHi].pKey, KL) <= 0) {
+			if (compareHighBound(NewSR, NewPfx, CurrentStore) <= 0) {
 				//  A new store must be added to the array to accomodate the key
 #ifdef INSTRUMENTED
 				Stats.NewStores++;
 				Stats.Stores++;
 #endif
-				pStoreChain->Store[pStoreChain->StoreCount] = new SplitStore<T>(NewSR, KL, Stats);
+				pStoreChain->Store[pStoreChain->StoreCount] = new (pStorePool) SplitStore<T, C>(NewSR, KL, KSASize, Stats, pSRAPool);
+				setBounds(pStoreChain->StoreCount, NewPfx);
 				pStoreChain->StoreCount++;
 
 				//  Test for trigger of a preemptive merge if the store count has exceeded the maximum
-				if (PMEnabled && (pStoreChain->StoreCount > MaxStores)) {
+				if (PMEnabled && ((pStoreChain->StoreCount > MaxStores) || isTierFull())) {
 					//  Perform the preemptive merge (tail suppression)
 #ifdef INSTRUMENTED
 					Stats.PMs++;
 #endif
-					suppressStableTail(Ascending);
+					preemptiveMerge(true, Ascending);
 					//  Recompute the Maximum number of stores
-					MaxStores = computeMaxStores(MaxStores, RecNo, MaxSInc);
+					MaxStores = PMP.getTrigger(MaxStores, RecNo, getStoreCost());
 
 					//  Check that there is capacity in the StoreChain structure to accomodate the maximum number of stores
-					if (MaxStores > pStoreChain->StoreCap) expandStoreChain();
+					while (MaxStores > pStoreChain->StoreCap) expandStoreChain();
 				}
 				else {
 					if (!PMEnabled) {
@@ -1322,6 +1488,9 @@ public:
 			}
 		}
 
+		//  Search outwards from the store that received the last key when finger search is enabled
+		if (FingerSearch && fingerSearch(NewSR, NewPfx, true, true)) return;
+
 		//
 		//  Setup to perform a Binary Chop search of the Store Chain beginning at the Mid-Point.
 		//
@@ -1336,12 +1505,12 @@ public:
 #ifdef INSTRUMENTED
 			Stats.Compares++;
 #endif
-			if (memcmp(NewSR.pKey, pStoreChain->Store[CurrentStore]->pSRA[pStoreChain->Store[CurrentStore]->SRALo].pKey, KL) >= 0) {
+			if (compareLowBound(NewSR, NewPfx, CurrentStore) >= 0) {
 				Below = false;
 #ifdef INSTRUMENTED
 				Stats.Compares++;
 #endif
-				if (memcmp(NewSR.pKey, pStoreChain->Store[CurrentStore]->pSRA[pStoreChain->Store[CurrentStore]->SRAHi].pKey, KL) <= 0) Without = false;
+				if (compareHighBound(NewSR, NewPfx, CurrentStore) <= 0) Without = false;
 				else Without = true;
 			}
 			else Without = true;
@@ -1351,11 +1520,11 @@ public:
 #ifdef INSTRUMENTED
 				Stats.Compares++;
 #endif
-				if (memcmp(NewSR.pKey, pStoreChain->Store[CurrentStore - 1]->pSRA[pStoreChain->Store[CurrentStore - 1]->SRALo].pKey, KL) >= 0) {
+				if (compareLowBound(NewSR, NewPfx, CurrentStore - 1) >= 0) {
 #ifdef INSTRUMENTED
 					Stats.Compares++;
 #endif
-					if (memcmp(NewSR.pKey, pStoreChain->Store[CurrentStore - 1]->pSRA[pStoreChain->Store[CurrentStore - 1]->SRAHi].pKey, KL) <= 0) OtherWithout = false;
+					if (compareHighBound(NewSR, NewPfx, CurrentStore - 1) <= 0) OtherWithout = false;
 					else OtherWithout = true;
 				}
 				else OtherWithout = true;
@@ -1364,6 +1533,8 @@ public:
 				if (!OtherWithout) {
 					if (Below) pStoreChain->Store[CurrentStore]->addLowExternalKey(NewSR);
 					else pStoreChain->Store[CurrentStore]->addHighExternalKey(NewSR);
+					if (Below) setLowBound(CurrentStore, NewPfx);
+					else setHighBound(CurrentStore, NewPfx);
 #ifdef INSTRUMENTED
 					if (Below) Stats.LoHits++;
 					else Stats.HiHits++;
@@ -1382,7 +1553,7 @@ public:
 
 				//  Move further to the left
 				CurrentStore = CurrentStore - Delta;
-				Delta = Delta / 2;
+				if (Delta > 1) Delta = Delta / 2;
 			}
 			else {
 				//  Moving to the right (higher index) - Test against [CurrentStore + 1]
@@ -1390,12 +1561,12 @@ public:
 #ifdef INSTRUMENTED
 				Stats.Compares++;
 #endif
-				if (memcmp(NewSR.pKey, pStoreChain->Store[CurrentStore + 1]->pSRA[pStoreChain->Store[CurrentStore + 1]->SRALo].pKey, KL) >= 0) {
+				if (compareLowBound(NewSR, NewPfx, CurrentStore + 1) >= 0) {
 					Below = false;
 #ifdef INSTRUMENTED
 					Stats.Compares++;
 #endif
-					if (memcmp(NewSR.pKey, pStoreChain->Store[CurrentStore + 1]->pSRA[pStoreChain->Store[CurrentStore + 1]->SRAHi].pKey, KL) <= 0) OtherWithout = false;
+					if (compareHighBound(NewSR, NewPfx, CurrentStore + 1) <= 0) OtherWithout = false;
 					else OtherWithout = true;
 				}
 				else OtherWithout = true;
@@ -1404,6 +1575,8 @@ public:
 				if (OtherWithout) {
 					if (Below) pStoreChain->Store[CurrentStore + 1]->addLowExternalKey(NewSR);
 					else pStoreChain->Store[CurrentStore + 1]->addHighExternalKey(NewSR);
+					if (Below) setLowBound(CurrentStore + 1, NewPfx);
+					else setHighBound(CurrentStore + 1, NewPfx);
 #ifdef INSTRUMENTED
 					if (Below) Stats.LoHits++;
 					else Stats.HiHits++;
@@ -1422,9 +1595,246 @@ public:
 
 				//  Move further to the right
 				CurrentStore = CurrentStore + Delta;
-				Delta = Delta / 2;
+				if (Delta > 1) Delta = Delta / 2;
+			}
+		}
+	}
+
+	//  addBlock
+	//
+	//  Adds a block of records to the Splitter Store chain, runs of ascending or descending keys in the block are
+	//  detected and added to their store in a single copy, preemptive merging is conditionally ENABLED
+	//
+	//  PARAMETERS:
+	//
+	//		T*				-		Pointer to the block of records to be added
+	//		size_t			-		Number of records in the block
+	//		bool			-		true if PM is emabled, false if disabled
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+	//	1.	The records are placed exactly as if they had been passed to add() one at a time.
+	//
+
+	void	addBlock(T* pBlock, size_t Count, bool PMEnabled) {
+		size_t		Next = 0;																//  Next record in the block
+
+		while (Next < Count) {
+			add(pBlock[Next], PMEnabled);
+			Next++;
+			Next += extendRun(pBlock + Next, Count - Next, false);
+		}
+
+		//  Return to caller
+		return;
+	}
+
+	//  addStableBlock
+	//
+	//  Adds a block of records to the Splitter Store chain with stable keys, runs of ascending or descending keys in the
+	//  block are detected and added to their store in a single copy, preemptive merging is conditionally ENABLED
+	//
+	//  PARAMETERS:
+	//
+	//		T*				-		Pointer to the block of records to be added
+	//		size_t			-		Number of records in the block
+	//		bool			-		true if the sequence is ascending false if descending
+	//		bool			-		true if PM is emabled, false if disabled
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+	//	1.	The records are placed exactly as if they had been passed to addStableKey() one at a time.
+	//
+
+	void	addStableBlock(T* pBlock, size_t Count, bool Ascending, bool PMEnabled) {
+		size_t		Next = 0;																//  Next record in the block
+
+		while (Next < Count) {
+			addStableKey(pBlock[Next], Ascending, PMEnabled);
+			Next++;
+			Next += extendRun(pBlock + Next, Count - Next, true);
+		}
+
+		//  Return to caller
+		return;
+	}
+
+	//  adoptStores
+	//
+	//  This function will move all of the stores of the passed Splitter onto the tail of this Splitter's store chain
+	//
+	//  PARAMETERS:
+	//
+	//		Splitter&		-		Reference to the Splitter that gives up its stores
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+	//	1.	The records of the donor MUST follow all of the records of this Splitter in the input sequence, the stable
+	//		final merge then keeps identical keys in input sequence.
+	//	2.	The store ranges of the combined chain no longer nest, no further keys may be added to this Splitter only
+	//		the end of the sort input may be signalled. The donor is left empty.
+	//
+
+	void	adoptStores(Splitter<T, C>& Donor) {
+		size_t			Adopted = 0;																//  Number of stores adopted
+
+		//  Complete any background preemptive merges
+		drainBackgroundPM();
+		Donor.drainBackgroundPM();
+		Adopted = Donor.pStoreChain->StoreCount;
+
+		//  Make room in the store chain
+		while ((pStoreChain->StoreCount + Adopted) > pStoreChain->StoreCap) expandStoreChain();
+
+		//  Move the stores
+		for (size_t sIndex = 0; sIndex < Adopted; sIndex++) {
+			pStoreChain->Store[pStoreChain->StoreCount++] = Donor.pStoreChain->Store[sIndex];
+			Donor.pStoreChain->Store[sIndex] = nullptr;
+		}
+		Donor.pStoreChain->StoreCount = 0;
+
+		//  The donor pools hold the adopted stores, they are kept until this Splitter is destroyed
+		pStorePool->adopt(Donor.pStorePool);
+		pSRAPool->adopt(Donor.pSRAPool);
+		Donor.pStorePool = Donor.pSRAPool = nullptr;
+
+		//  Move the record count
+		RecNo += Donor.RecNo;
+		Donor.RecNo = 0;
+		LastStore = pStoreChain->StoreCount;
+
+		//  Return to caller
+		return;
+	}
+
+	//  setPMPolicy
+	//
+	//  This function sets the preemptive merge policy that is applied by the Splitter
+	//
+	//  PARAMETERS:
+	//
+	//		PMPolicy&		-		Const reference to the policy
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+	//	1.	The policy MUST be set before any keys are added beyond the initial key.
+	//
+
+	void	setPMPolicy(const PMPolicy& Policy) {
+
+		//  Capture the policy and establish the initial trigger
+		PMP = Policy;
+		if (PMP.Strategy == PMP_BUDGET || PMP.Strategy == PMP_LSM) MaxStores = PMP.getTrigger(0, RecNo, getStoreCost());
+		else MaxStores = PMP.MaxStores;
+
+		//  Check that there is capacity in the StoreChain structure to accomodate the maximum number of stores
+		while (MaxStores > pStoreChain->StoreCap) expandStoreChain();
+
+		//  Return to caller
+		return;
+	}
+
+	//  setMergeThreads
+	//
+	//  This function sets the number of threads that will be used to perform the final merge
+	//
+	//  PARAMETERS:
+	//
+	//		size_t			-		Number of threads, 0 = hardware concurrency, 1 = single threaded
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+	//	1.	Each round of the final merge is made up of independent pair merges, these are spread across the pool.
+	//
+
+	void	setMergeThreads(size_t Threads) {
+
+		//  Dismiss any existing pool
+		if (pMergePool != nullptr) delete pMergePool;
+		pMergePool = nullptr;
+
+		//  Create a pool if more than a single thread is available
+		if (Threads != 1) {
+			pMergePool = new WorkerPool(Threads);
+			if (pMergePool->getThreads() < 2) {
+				delete pMergePool;
+				pMergePool = nullptr;
 			}
 		}
+
+		//  Return to caller
+		return;
+	}
+
+	//  setMergePathThreshold
+	//
+	//  This function sets the minimum number of records in a single final merge for the merge to be partitioned
+	//
+	//  PARAMETERS:
+	//
+	//		size_t			-		Minimum number of records (combined) in a partitioned merge
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+
+	void	setMergePathThreshold(size_t Threshold) { MergePathMin = Threshold; return; }
+
+	//  enableSizedMerge
+	//
+	//  This function enables the size ordered final merge schedule, the adjacent pair of stores with the fewest
+	//  records is always merged next instead of merging alternate stores in rounds.
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+
+	void	enableSizedMerge() { SizedFM = true; return; }
+
+	//  enableFingerSearch
+	//
+	//  This function enables the finger search of the store chain, the store that will receive a new key is searched
+	//  for outwards from the store that received the previous key before resorting to the binary chop.
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+
+	void	enableFingerSearch() { FingerSearch = true; return; }
+
+	//  getMergeThreads
+	//
+	//  Returns the number of threads that will be used to perform the final merge
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//		size_t			-		Number of threads
+	//
+	//  NOTES:
+	//
+
+	size_t	getMergeThreads() const {
+		if (pMergePool == nullptr) return 1;
+		return pMergePool->getThreads();
 	}
 
 	//  signalEndOfSortInput
@@ -1441,12 +1851,25 @@ public:
 	// 
 
 	size_t	signalEndOfSortInput() {
-		size_t			NumStores = pStoreChain->StoreCount;
+		size_t			NumStores = 0;													//  Stores to be merged
+		size_t			AltMoves = 0;													//  Records moved by alternate merging
+
+		//  Complete any background preemptive merge
+		drainBackgroundPM();
+		NumStores = pStoreChain->StoreCount;
+		AltMoves = getAlternateMoves();
 
 		//  Perform pre-emptive merges until there is only a single store remaining
 		Stats.startFM();
-		while (pStoreChain->StoreCount > 1) {
-			doAlternateMerge();
+		if (SizedFM) Stats.recordFMMoves(doSizedMerge(false, true), AltMoves);
+		else {
+			prepareMergeBuffers();
+			while (pStoreChain->StoreCount > 1) {
+				startMergeRound();
+				if (pMergePool != nullptr) doParallelAlternateMerge(false, true);
+				else doAlternateMerge();
+			}
+			Stats.recordFMMoves(AltMoves, AltMoves);
 		}
 		Stats.finishFM(NumStores);
 
@@ -1470,12 +1893,25 @@ public:
 	// 
 
 	size_t	signalEndOfStableSortInput(bool Ascending) {
-		size_t			NumStores = pStoreChain->StoreCount;
+		size_t			NumStores = 0;													//  Stores to be merged
+		size_t			AltMoves = 0;													//  Records moved by alternate merging
+
+		//  Complete any background preemptive merge
+		drainBackgroundPM();
+		NumStores = pStoreChain->StoreCount;
+		AltMoves = getAlternateMoves();
 
 		//  Perform pre-emptive merges until there is only a single store remaining
 		Stats.startFM();
-		while (pStoreChain->StoreCount > 1) {
-			doStableAlternateMerge(Ascending);
+		if (SizedFM) Stats.recordFMMoves(doSizedMerge(true, Ascending), AltMoves);
+		else {
+			prepareMergeBuffers();
+			while (pStoreChain->StoreCount > 1) {
+				startMergeRound();
+				if (pMergePool != nullptr) doParallelAlternateMerge(true, Ascending);
+				else doStableAlternateMerge(Ascending);
+			}
+			Stats.recordFMMoves(AltMoves, AltMoves);
 		}
 		Stats.finishFM(NumStores);
 
@@ -1483,10 +1919,71 @@ public:
 		return pStoreChain->Store[0]->SRANum;
 	}
 
+	//  signalEndOfStreamedSortInput
+	//
+	//  This function will complete the sort input by preparing a k-way merge over all of the stores in the chain,
+	//  the merged records are then delivered one at a time by nextOutput() in the requested sequence.
+	//
+	//  PARAMETERS:
+	//
+	//		bool			-		true if the sequence is ascending false if descending
+	//
+	//  RETURNS:
+	// 
+	//		size_t		-		Count of records input
+	//
+	//  NOTES:
+	//
+	//	1.	The same function is used for stable and unstable keys, identical keys are delivered in store chain order.
+	// 
+
+	size_t	signalEndOfStreamedSortInput(bool Ascending) {
+		size_t			NumStores = 0;													//  Stores to be merged
+
+		//  Complete any background preemptive merge
+		drainBackgroundPM();
+		NumStores = pStoreChain->StoreCount;
+
+		//  Build the tournament over the stores
+		Stats.startFM();
+		if (pStreamFM != nullptr) delete pStreamFM;
+		pStreamFM = nullptr;
+		for (size_t sIndex = 0; sIndex < NumStores; sIndex++) {
+			if (!pStoreChain->Store[sIndex]->flatten()) {
+				//  The failure is picked up by isOutputValid()
+				Stats.finishFM(NumStores);
+				return RecNo;
+			}
+		}
+		pStreamFM = new LoserTree<T, C>(pStoreChain->Store, NumStores, KL, Ascending);
+		Stats.finishFM(NumStores);
+
+		//  Return to caller
+		return RecNo;
+	}
+
+	//  nextOutput
+	//
+	//  This function will return the next record from a streamed final merge
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	// 
+	//		T*			-		Pointer to the next record in sequence, nullptr if there are no more records
+	//
+	//  NOTES:
+	// 
+
+	T*		nextOutput() {
+		if (pStreamFM == nullptr) return nullptr;
+		return pStreamFM->next();
+	}
+
 	//  isOutputValid
 	//
 	//  This function will check that the number of records input to the sort is equal to the number of records
-	//  in the root store.
+	//  in the store chain and that the records of every store are contiguous.
 	//
 	//  PARAMETERS:
 	//
@@ -1495,11 +1992,19 @@ public:
 	//		bool		-		true if the output is valid, otherwise false
 	//
 	//  NOTES:
+	//
+	//	1.	The output iterators and the streamed final merge only deliver the records that are contiguous in the
+	//		SRA of a store, a store that cannot be flattened would silently lose the records held in its segments.
 	// 
 
 	bool	isOutputValid() {
+		size_t			Records = 0;																//  Records held in the store chain
 
-		if (RecNo != pStoreChain->Store[0]->SRANum) return false;
+		for (size_t sIndex = 0; sIndex < pStoreChain->StoreCount; sIndex++) {
+			if (!pStoreChain->Store[sIndex]->flatten()) return false;
+			Records += pStoreChain->Store[sIndex]->SRANum;
+		}
+		if (RecNo != Records) return false;
 		return true;
 	}
 
@@ -1518,9 +2023,12 @@ public:
 	//		Output&			-		Reference to the iterator positioned to the lowest entry
 	//
 	//  NOTES:
+	//
+	//	1.	isOutputValid() MUST have been checked, it ensures that the records of the store are contiguous.
 	//  
 
 	Output lowest() {
+		pStoreChain->Store[0]->flatten();
 		return Output(&pStoreChain->Store[0]->pSRA[pStoreChain->Store[0]->SRALo], pStoreChain->Store[0]->SRALo);
 	}
 
@@ -1535,9 +2043,12 @@ public:
 	//		Output&			-		Reference to the iterator positioned to the highest entry
 	//
 	//  NOTES:
+	//
+	//	1.	isOutputValid() MUST have been checked, it ensures that the records of the store are contiguous.
 	//  
 
 	Output highest() {
+		pStoreChain->Store[0]->flatten();
 		return Output(&pStoreChain->Store[0]->pSRA[pStoreChain->Store[0]->SRAHi], pStoreChain->Store[0]->SRAHi);
 	}
 
@@ -1551,15 +2062,51 @@ private:
 
 	//  Configuration
 	size_t			KL;																		//  Key Length
+	size_t			KSASize;																//  Keystore Arena Size in KB (0 = no keystore)
 	IStats& Stats;																	//  Reference to the instrumentation object
 
 	//  Preemptive Merge Controls
 	size_t			RecNo;																	//  Record counter
 	size_t			MaxStores;																//  Maximum number of splitter stores
-	size_t			MaxSInc;																//  Percentage of Max Stores
+	PMPolicy		PMP;																	//  Preemptive merge policy
+
+	//  Background Preemptive Merge Controls
+	std::thread		BGThread;																//  Background merge thread
+	std::atomic<bool>	BGDone;																//  Background merge has finished
+	SplitStore<T, C>**	pBGStores;															//  Stores detached for the background merge (nullptr = none)
+	size_t			BGCount;																//  Number of detached stores
+	size_t			BGTarget;																//  Chain index of the merged store
+	bool			BGStable;																//  Background merge is stable
+	bool			BGAscending;															//  Background merge sequence
+	xymorg::MICROSECONDS	BGMergeTime;													//  Duration of the background merge
+	T*				pDeferred;																//  Keys deferred during the background merge
+	size_t			DeferCount;																//  Number of deferred keys
+	size_t			DeferCap;																//  Capacity of the deferred keys
+	size_t			DeferFirst;																//  First deferred key still to be added
+	size_t			DeferHead;																//  Stores at the head of the chain while keys are deferred
+	bool			Amortising;																//  An amortised PM is in progress
+	bool			Replaying;																//  Deferred keys are being added
+	bool			BGStaged;																//  Amortised merge is staged
 
 	//  SplitStore Chain
 	StoreChain* pStoreChain;															//  Pointer to the store chain structure
+	SlabPool*		pStorePool;																//  Pool for the SplitStore objects
+	SlabPool*		pSRAPool;																//  Pool for the initial SRAs and segments of the stores
+
+	//  Boundary Key Index
+	void*			pBoundMem;																//  Boundary key index allocation
+	uint64_t*		pLoBound;																//  Low key prefix of each store (cache aligned)
+	uint64_t*		pHiBound;																//  High key prefix of each store (cache aligned)
+	size_t			BoundCap;																//  Capacity of the boundary key index (stores)
+	size_t			LastStore;																//  Store that received the last key (>= StoreCount = unknown)
+	bool			FingerSearch;														//  Search for the target store from LastStore (finger)
+
+	//  Final Merge Controls
+	WorkerPool* pMergePool;															//  Worker pool for the final merge (nullptr = single threaded)
+	size_t			MergePathMin;															//  Minimum records in a merge for it to be partitioned
+	bool			SizedFM;																//  Final merge pairs are scheduled by size
+	LoserTree<T, C>*	pStreamFM;																//  Streamed final merge (k-way) tournament
+	MergeBuffers<T>	Buffers;																//  Final merge target buffers
 
 	//*******************************************************************************************************************
 	//*                                                                                                                 *
@@ -1570,7 +2117,8 @@ private:
 	//  suppressTail
 	//
 	//  This function will perform a preemptive merge on the current splitter store chain.
-	//  The merge pattern sweeps up stores from the tail merging 10% of the total store chain.
+	//  The merge pattern sweeps up stores from the tail merging m/n (default 10%) of the total store chain, the tail
+	//  stores are merged into their predecessor in a single (k-way) pass.
 	//
 	//  PARAMETERS:
 	// 
@@ -1581,26 +2129,24 @@ private:
 
 	void	suppressTail() {
 		size_t				Stores = pStoreChain->StoreCount;								//  Current number of stores
-		size_t				Target = (Stores * 9) / 10;										//  90% of existing stores
+		size_t				Target = Stores - PMP.getMerges(Stores);						//  Stores remaining after the PM
 
 		//  Record start time
 		Stats.startPM();
 
-		//  Eliminate the ultimate store until the target number of stores is reached
-		while (Stores > Target) {
-#ifdef INSTRUMENTED
-			Stats.startStoreMerge(int(pStoreChain->Store[Stores - 2]->SRANum), int(pStoreChain->Store[Stores - 1]->SRANum));
-#endif
-			pStoreChain->Store[Stores - 2]->mergeNextStore(pStoreChain->Store[Stores - 1]);
-			pStoreChain->Store[Stores - 1] = nullptr;
-			Stores--;
+		//  Merge the tail stores into the store that precedes them in a single pass
+		if (Target < Stores) {
+			mergeStoreRange(&pStoreChain->Store[Target - 1], (Stores - Target) + 1, false, true);
+			Stores = Target;
 		}
+		setBoundaries(Stores - 1);
 
 		//  Accumulate the time spent
 		Stats.finishPM(pStoreChain->StoreCount - Stores);
 
-		//  Update the store count
+		//  Update the store count, the last store to receive a key is no longer known
 		pStoreChain->StoreCount = Stores;
+		LastStore = Stores;
 
 		//  Return to caller
 		return;
@@ -1609,7 +2155,8 @@ private:
 	//  suppressStableTail
 	//
 	//  This function will perform a preemptive stable merge on the current splitter store chain.
-	//  The merge pattern sweeps up stores from the tail merging 10% of the total store chain.
+	//  The merge pattern sweeps up stores from the tail merging m/n (default 10%) of the total store chain, the tail
+	//  stores are merged into their predecessor in a single (k-way) pass.
 	//
 	//  PARAMETERS:
 	//
@@ -1622,72 +2169,942 @@ private:
 
 	void	suppressStableTail(bool Ascending) {
 		size_t				Stores = pStoreChain->StoreCount;								//  Current number of stores
-		size_t				Target = (Stores * 9) / 10;										//  90% of existing stores
+		size_t				Target = Stores - PMP.getMerges(Stores);						//  Stores remaining after the PM
 
 		//  Record start time
 		Stats.startPM();
 
-		//  Eliminate the ultimate store until the target number of stores is reached
-		while (Stores > Target) {
-#ifdef INSTRUMENTED
-			Stats.startStoreMerge(int(pStoreChain->Store[Stores - 2]->SRANum), int(pStoreChain->Store[Stores - 1]->SRANum));
-#endif
-			if (Ascending) pStoreChain->Store[Stores - 1]->mergeNextStoreAscending(pStoreChain->Store[Stores - 1]);
-			else pStoreChain->Store[Stores - 2]->mergeNextStoreDescending(pStoreChain->Store[Stores - 1]);
-			pStoreChain->Store[Stores - 1] = nullptr;
-			Stores--;
+		//  Merge the tail stores into the store that precedes them in a single pass
+		if (Target < Stores) {
+			mergeStoreRange(&pStoreChain->Store[Target - 1], (Stores - Target) + 1, true, Ascending);
+			Stores = Target;
 		}
+		setBoundaries(Stores - 1);
 
 		//  Accumulate the time spent
 		Stats.finishPM(pStoreChain->StoreCount - Stores);
 
-		//  Update the store count
+		//  Update the store count, the last store to receive a key is no longer known
 		pStoreChain->StoreCount = Stores;
+		LastStore = Stores;
 
 		//  Return to caller
 		return;
 	}
 
-	//  doAlternateMerge
+	//  detachTail
 	//
-	//  This function will perform a final merge on the current splitter store chain.
-	//  The merge pattern is alternate stores are merged into their predecessors on the chain.
+	//  This function will detach the stores to be merged by a tail PM (and the store that precedes them) from the
+	//  store chain, insertion continues on the stores at the head of the chain while the detached stores are merged.
 	//
 	//  PARAMETERS:
+	//
+	//		bool		-		true if the keys are stable
+	//		bool		-		true if the sequence is ascending false if descending (stable only)
+	//		size_t		-		Minimum number of records to be merged
 	// 
 	//  RETURNS:
 	//
+	//		bool		-		true if the stores were detached, false if the PM must be performed in the foreground
+	//
 	//  NOTES:
+	//
+	//	1.	Only the in-memory model is detached, at least one store must remain on the chain.
 	// 
 
-	void	doAlternateMerge() {
-		int					sIndex = 0;														//  Store index
-		int					tIndex = 0;														//  Target index
+	bool	detachTail(bool Stable, bool Ascending, size_t MinRecords) {
 		size_t				Stores = pStoreChain->StoreCount;								//  Current number of stores
+		size_t				Target = Stores - PMP.getMerges(Stores);						//  Stores remaining after the PM
+		size_t				Records = 0;													//  Records to be merged
 
-		//  Process all stores
-		while (size_t(sIndex) < pStoreChain->StoreCount) {
+		if (KSASize != 0 || Target < 2 || Target >= Stores || pBGStores != nullptr) return false;
 
-			// Merge the following splitter into the current one
-			if (size_t(sIndex + 1) < pStoreChain->StoreCount) {
-#ifdef INSTRUMENTED
-				Stats.startStoreMerge(int(pStoreChain->Store[sIndex]->SRANum), int(pStoreChain->Store[sIndex + 1]->SRANum));
-#endif
-				pStoreChain->Store[sIndex]->mergeNextStore(pStoreChain->Store[sIndex + 1]);
-				pStoreChain->Store[sIndex + 1] = nullptr;
-				Stores--;
-			}
+		//  Small merges are left to the foreground
+		for (size_t sIndex = Target - 1; sIndex < Stores; sIndex++) Records += pStoreChain->Store[sIndex]->SRANum;
+		if (Records < MinRecords) return false;
 
-			if (tIndex > 0) {
-				pStoreChain->Store[tIndex] = pStoreChain->Store[sIndex];
-				pStoreChain->Store[sIndex] = nullptr;
-			}
-			//  Move on to the next pair
-			sIndex += 2;
-			tIndex++;
+		//  Record start time
+		Stats.startPM();
+
+		//  Detach the stores to be merged from the chain
+		BGCount = (Stores - Target) + 1;
+		BGTarget = Target - 1;
+		BGStable = Stable;
+		BGAscending = Ascending;
+		pBGStores = (SplitStore<T, C>**) malloc(BGCount * sizeof(SplitStore<T, C>*));
+		if (pBGStores == nullptr) {
+			//  Fatal
+			std::cerr << "FATAL: Failed to allocate a detached merge of: " << BGCount << " stores." << std::endl;
+			std::abort();
+		}
+		for (size_t sIndex = 0; sIndex < BGCount; sIndex++) {
+			pBGStores[sIndex] = pStoreChain->Store[BGTarget + sIndex];
+			pStoreChain->Store[BGTarget + sIndex] = nullptr;
 		}
 
-		pStoreChain->StoreCount = Stores;
+		//  Accumulate the time spent
+		Stats.finishPM(BGCount - 1);
+
+		//  Update the store count, the last store to receive a key is no longer known
+		pStoreChain->StoreCount = BGTarget;
+		LastStore = BGTarget;
+
+		//  Return showing the stores were detached
+		return true;
+	}
+
+	//  attachTail
+	//
+	//  This function will return the merged store to the tail of the store chain once the detached stores are merged.
+	//
+	//  PARAMETERS:
+	// 
+	//  RETURNS:
+	//
+	//  NOTES:
+	// 
+
+	void	attachTail() {
+
+		pStoreChain->Store[BGTarget] = pBGStores[0];
+		pStoreChain->StoreCount = BGTarget + 1;
+		setBoundaries(BGTarget);
+		LastStore = pStoreChain->StoreCount;
+		free(pBGStores);
+		pBGStores = nullptr;
+
+		//  Return to caller
+		return;
+	}
+
+	//  startBackgroundPM
+	//
+	//  This function will start a preemptive merge of the tail of the store chain on a background thread.
+	//
+	//  PARAMETERS:
+	//
+	//		bool		-		true if the keys are stable
+	//		bool		-		true if the sequence is ascending false if descending (stable only)
+	// 
+	//  RETURNS:
+	//
+	//		bool		-		true if the merge was started, false if the PM must be performed in the foreground
+	//
+	//  NOTES:
+	//
+	//	1.	Merges of fewer than 64K records are cheaper in the foreground than starting a thread.
+	// 
+
+	bool	startBackgroundPM(bool Stable, bool Ascending) {
+
+		if (!detachTail(Stable, Ascending, 65536)) return false;
+
+		//  Start the merge
+		BGDone = false;
+		BGThread = std::thread([this]() {
+			xymorg::TIMER		Start = xymorg::CLOCK::now();									//  Start of the merge
+
+			mergeStoreRange(pBGStores, BGCount, BGStable, BGAscending);
+			BGMergeTime = DURATION(xymorg::MICROSECONDS, xymorg::CLOCK::now() - Start);
+			BGDone = true;
+			return;
+			});
+
+		//  Return showing the merge was started
+		return true;
+	}
+
+	//  completeBackgroundPM
+	//
+	//  This function will wait for the background preemptive merge to complete, return the merged store to the tail
+	//  of the store chain and then add the keys that were deferred while the merge was running.
+	//
+	//  PARAMETERS:
+	// 
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+	//	1.	Adding the deferred keys may trigger (and start) another background PM.
+	// 
+
+	void	completeBackgroundPM() {
+		xymorg::TIMER		StartStall = xymorg::CLOCK::now();									//  Start of the stall
+		T*					pKeys = pDeferred;													//  Deferred keys
+		size_t				Keys = DeferCount;													//  Number of deferred keys
+
+		//  Wait for the merge and return the merged store to the chain
+		BGThread.join();
+		attachTail();
+		Stats.recordBackgroundPM(BGMergeTime, DURATION(xymorg::MICROSECONDS, xymorg::CLOCK::now() - StartStall));
+
+		//  Add the deferred keys in input sequence
+		pDeferred = nullptr;
+		DeferCount = DeferCap = 0;
+		for (size_t kIndex = 0; kIndex < Keys; kIndex++) {
+			if (BGStable) addStableKey(pKeys[kIndex], BGAscending, true);
+			else add(pKeys[kIndex], true);
+		}
+		if (pKeys != nullptr) free(pKeys);
+
+		//  Return to caller
+		return;
+	}
+
+	//  startAmortisedPM
+	//
+	//  This function will start a preemptive merge of the tail of the store chain that is amortised over the
+	//  following insertions.
+	//
+	//  PARAMETERS:
+	//
+	//		bool		-		true if the keys are stable
+	//		bool		-		true if the sequence is ascending false if descending (stable only)
+	// 
+	//  RETURNS:
+	//
+	//		bool		-		true if the merge was started, false if the PM must be performed in the foreground
+	//
+	//  NOTES:
+	//
+	//	1.	Merges that fit within a single quantum are performed in the foreground.
+	//	2.	Keys deferred by an earlier amortised PM may still be waiting, the head of the chain is then the shorter of
+	//		the two heads.
+	// 
+
+	bool	startAmortisedPM(bool Stable, bool Ascending) {
+
+		if (!detachTail(Stable, Ascending, PMP.Quantum + 1)) return false;
+
+#ifdef INSTRUMENTED
+		{
+			size_t		Recs = pBGStores[0]->SRANum;												//  Records in the target
+
+			for (size_t sIndex = 1; sIndex < BGCount; sIndex++) {
+				Stats.startStoreMerge(int(Recs), int(pBGStores[sIndex]->SRANum));
+				Recs += pBGStores[sIndex]->SRANum;
+			}
+		}
+#endif
+
+		//  Merge the mergees ahead of the target when the target dominates the merge (see mergeStoreRange)
+		{
+			size_t		Mergees = 0;																//  Records in the mergees
+			size_t		Ways = 1;																	//  log2(k)
+
+			for (size_t sIndex = 1; sIndex < BGCount; sIndex++) Mergees += pBGStores[sIndex]->SRANum;
+			while ((size_t(1) << Ways) < BGCount) Ways++;
+			BGStaged = (BGCount > 2) && ((Mergees * Ways) + Mergees + pBGStores[0]->SRANum) < ((Mergees + pBGStores[0]->SRANum) * Ways);
+		}
+
+		//  Set the head of the chain
+		if (!Amortising || DeferFirst == DeferCount || BGTarget < DeferHead) DeferHead = BGTarget;
+		Amortising = true;
+
+		//  Return showing the merge was started
+		return true;
+	}
+
+	//  amortisePM
+	//
+	//  This function is called ahead of each insertion while an amortised PM is in progress, it performs the next
+	//  quantum of the PM and then determines if the key must be deferred.
+	//
+	//  PARAMETERS:
+	//
+	//		T&			-		Reference to the Sort Record to be added
+	//		uint64_t	-		Key prefix of the record
+	//		bool		-		true if the keys are stable
+	// 
+	//  RETURNS:
+	//
+	//		bool		-		true if the key was deferred, false if it must be added now
+	//
+	//  NOTES:
+	//
+	//	1.	A quantum is q records moved by the merge or, once the merged store is back on the chain, q/8 (at least 2)
+	//		deferred keys added.
+	//	2.	Deferred keys lie within the range of every store at the head of the chain, a key that does not is placed
+	//		at the head and is independent of them. Any other key is deferred behind them to keep the input sequence.
+	// 
+
+	bool	amortisePM(T& NewSR, uint64_t NewPfx, bool Stable) {
+		xymorg::TIMER		StartStep = xymorg::CLOCK::now();									//  Start of the step
+
+		//  Perform the next quantum of the PM
+		if (pBGStores != nullptr) {
+			if (stepDetachedMerge(PMP.Quantum)) {
+				attachTail();
+				if (DeferFirst == DeferCount) endAmortisedPM();
+			}
+		}
+		else replayDeferred((PMP.Quantum / 8) + 2);
+		Stats.recordPMStep(DURATION(xymorg::MICROSECONDS, xymorg::CLOCK::now() - StartStep));
+
+		//  Determine if the key is placed at the head of the chain
+		if (!Amortising) return false;
+		if (Stable) {
+			if (compareLowBound(NewSR, NewPfx, DeferHead - 1) < 0) return false;
+			if (compareHighBound(NewSR, NewPfx, DeferHead - 1) > 0) return false;
+		}
+		else {
+			if (compareLowBound(NewSR, NewPfx, DeferHead - 1) <= 0) return false;
+			if (compareHighBound(NewSR, NewPfx, DeferHead - 1) >= 0) return false;
+		}
+
+		//  Defer the key
+		queueKey(NewSR);
+		LastStore = pStoreChain->StoreCount;
+
+		//  Return showing the key was deferred
+		return true;
+	}
+
+	//  stepDetachedMerge
+	//
+	//  This function will perform the next step of the merge of the detached stores of an amortised PM.
+	//
+	//  PARAMETERS:
+	//
+	//		size_t		-		Maximum number of records to move
+	// 
+	//  RETURNS:
+	//
+	//		bool		-		true if the merge is complete, false if it must be continued
+	//
+	//  NOTES:
+	//
+	//	1.	A staged merge first merges the mergees into the first mergee and then merges that into the target, the
+	//		records of a large target are then compared once rather than log2(k) times. The k-way merge is
+	//		associative so the order of identical keys is unchanged.
+	// 
+
+	bool	stepDetachedMerge(size_t MaxMoves) {
+		bool			MergeeFirst = BGStable && !BGAscending;								//  Mergee records first on identical keys
+
+		//  Single pass
+		if (!BGStaged) {
+			if (!pBGStores[0]->mergeFollowingStores(pBGStores, BGCount, MergeeFirst, MaxMoves)) return false;
+			for (size_t sIndex = 1; sIndex < BGCount; sIndex++) pBGStores[sIndex] = nullptr;
+			return true;
+		}
+
+		//  Staged, merge the mergees then merge the result into the target
+		if (pBGStores[2] != nullptr) {
+			if (pBGStores[1]->mergeFollowingStores(&pBGStores[1], BGCount - 1, MergeeFirst, MaxMoves)) {
+				for (size_t sIndex = 2; sIndex < BGCount; sIndex++) pBGStores[sIndex] = nullptr;
+			}
+			return false;
+		}
+		if (!pBGStores[0]->mergeFollowingStores(pBGStores, 2, MergeeFirst, MaxMoves)) return false;
+		pBGStores[1] = nullptr;
+		return true;
+	}
+
+	//  replayDeferred
+	//
+	//  This function will add keys that were deferred by an amortised PM in input sequence.
+	//
+	//  PARAMETERS:
+	//
+	//		size_t		-		Maximum number of keys to add
+	// 
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+	//	1.	Adding a key may start another amortised PM, the remaining keys then wait for it.
+	// 
+
+	void	replayDeferred(size_t MaxKeys) {
+		T					Key = {};															//  Key being added
+
+		Replaying = true;
+		for (size_t kIndex = 0; kIndex < MaxKeys && DeferFirst < DeferCount && pBGStores == nullptr; kIndex++) {
+			Key = pDeferred[DeferFirst++];
+			if (BGStable) addStableKey(Key, BGAscending, true);
+			else add(Key, true);
+		}
+		Replaying = false;
+		if (pBGStores == nullptr && DeferFirst == DeferCount) endAmortisedPM();
+
+		//  Return to caller
+		return;
+	}
+
+	//  endAmortisedPM
+	//
+	//  This function will end an amortised PM once the merged store is on the chain and no keys are deferred.
+	//
+	//  PARAMETERS:
+	// 
+	//  RETURNS:
+	//
+	//  NOTES:
+	// 
+
+	void	endAmortisedPM() {
+
+		Amortising = false;
+		DeferFirst = DeferCount = 0;
+
+		//  Return to caller
+		return;
+	}
+
+	//  drainBackgroundPM
+	//
+	//  This function will complete any background or amortised preemptive merge, all stores are then on the store
+	//  chain and no keys are deferred.
+	//
+	//  PARAMETERS:
+	// 
+	//  RETURNS:
+	//
+	//  NOTES:
+	// 
+
+	void	drainBackgroundPM() {
+
+		while (pBGStores != nullptr || Amortising) {
+			if (!Amortising) completeBackgroundPM();
+			else if (pBGStores != nullptr) {
+				while (!stepDetachedMerge(SIZE_MAX));
+				attachTail();
+				if (DeferFirst == DeferCount) endAmortisedPM();
+			}
+			else replayDeferred(DeferCount - DeferFirst);
+		}
+
+		//  Return to caller
+		return;
+	}
+
+	//  queueKey
+	//
+	//  This function will append a key to the deferred keys.
+	//
+	//  PARAMETERS:
+	//
+	//		T&			-		Reference to the Sort Record to be deferred
+	// 
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+	//	1.	Keys that have already been added are discarded from the front of the queue before it is expanded.
+	// 
+
+	void	queueKey(T& NewSR) {
+
+		if (DeferCount == DeferCap) {
+			if (DeferFirst > 0) {
+				memmove(pDeferred, &pDeferred[DeferFirst], (DeferCount - DeferFirst) * sizeof(T));
+				DeferCount -= DeferFirst;
+				DeferFirst = 0;
+			}
+			else {
+				T*			pNewDefer = nullptr;												//  Expanded deferred keys
+
+				if (DeferCap == 0) DeferCap = 256;
+				else DeferCap = DeferCap * 2;
+				pNewDefer = (T*) realloc(pDeferred, DeferCap * sizeof(T));
+				if (pNewDefer == nullptr) {
+					//  Fatal
+					std::cerr << "FATAL: Failed to expand the deferred keys to: " << DeferCap << " keys." << std::endl;
+					std::abort();
+				}
+				pDeferred = pNewDefer;
+			}
+		}
+		pDeferred[DeferCount++] = NewSR;
+
+		//  Return to caller
+		return;
+	}
+
+	//  deferKey
+	//
+	//  This function will defer a key that lies within the key range of every store at the head of the chain while a
+	//  background preemptive merge is running, the key is added when the merge is complete.
+	//
+	//  PARAMETERS:
+	//
+	//		T&			-		Reference to the Sort Record to be deferred
+	// 
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+	//	1.	The key is not counted until it is added, the merge is completed when it has finished or when too many
+	//		keys are waiting for it.
+	// 
+
+	void	deferKey(T& NewSR) {
+
+		//  Uncount the key
+		RecNo--;
+		Stats.NumKeys--;
+
+		//  Queue the key
+		queueKey(NewSR);
+		LastStore = pStoreChain->StoreCount;
+
+		//  Complete the merge if it has finished or the insertion must wait for it
+		if (BGDone || DeferCount >= 4096) completeBackgroundPM();
+
+		//  Return to caller
+		return;
+	}
+
+	//  preemptiveMerge
+	//
+	//  This function will perform a preemptive merge on the current splitter store chain using the strategy selected
+	//  by the PM policy.
+	//
+	//  PARAMETERS:
+	//
+	//		bool		-		true if the keys are stable
+	//		bool		-		true if the sequence is ascending false if descending (stable only)
+	// 
+	//  RETURNS:
+	//
+	//  NOTES:
+	// 
+
+	void	preemptiveMerge(bool Stable, bool Ascending) {
+
+		switch (PMP.Strategy) {
+		case PMP_HEAD:
+			suppressHead(Stable, Ascending);
+			break;
+
+		case PMP_ALTERNATE:
+			suppressAlternate(Stable, Ascending);
+			break;
+
+		case PMP_TIERED:
+			suppressTiered(Stable, Ascending);
+			break;
+
+		case PMP_LSM:
+			suppressTiers(Stable, Ascending);
+			break;
+
+		default:
+#ifndef INSTRUMENTED
+			if (PMP.Background && startBackgroundPM(Stable, Ascending)) break;
+#endif
+			if (PMP.Quantum > 0 && startAmortisedPM(Stable, Ascending)) break;
+			if (Stable) suppressStableTail(Ascending);
+			else suppressTail();
+			break;
+		}
+
+		//  Return to caller
+		return;
+	}
+
+	//  suppressHead
+	//
+	//  This function will perform a preemptive merge on the current splitter store chain.
+	//  The merge pattern sweeps up stores into the head of the chain merging m/n of the total store chain.
+	//
+	//  PARAMETERS:
+	//
+	//		bool		-		true if the keys are stable
+	//		bool		-		true if the sequence is ascending false if descending (stable only)
+	// 
+	//  RETURNS:
+	//
+	//  NOTES:
+	// 
+
+	void	suppressHead(bool Stable, bool Ascending) {
+		size_t				Stores = pStoreChain->StoreCount;								//  Current number of stores
+		size_t				Merges = PMP.getMerges(Stores);									//  Stores to be merged
+
+		//  Record start time
+		Stats.startPM();
+
+		//  Merge the stores following the head into the head in a single pass
+		mergeStoreRange(&pStoreChain->Store[0], Merges + 1, Stable, Ascending);
+
+		//  Close up the chain
+		for (size_t sIndex = Merges + 1; sIndex < Stores; sIndex++) {
+			pStoreChain->Store[sIndex - Merges] = pStoreChain->Store[sIndex];
+			pStoreChain->Store[sIndex] = nullptr;
+		}
+		Stores = Stores - Merges;
+		for (size_t sIndex = 0; sIndex < Stores; sIndex++) setBoundaries(sIndex);
+
+		//  Accumulate the time spent
+		Stats.finishPM(pStoreChain->StoreCount - Stores);
+
+		//  Update the store count, the last store to receive a key is no longer known
+		pStoreChain->StoreCount = Stores;
+		LastStore = Stores;
+
+		//  Return to caller
+		return;
+	}
+
+	//  suppressAlternate
+	//
+	//  This function will perform a preemptive merge on the current splitter store chain.
+	//  The merge pattern is alternate stores are merged into their predecessors on the chain, halving the chain.
+	//
+	//  PARAMETERS:
+	//
+	//		bool		-		true if the keys are stable
+	//		bool		-		true if the sequence is ascending false if descending (stable only)
+	// 
+	//  RETURNS:
+	//
+	//  NOTES:
+	// 
+
+	void	suppressAlternate(bool Stable, bool Ascending) {
+		size_t				Stores = pStoreChain->StoreCount;								//  Current number of stores
+
+		//  Record start time
+		Stats.startPM();
+
+		//  Merge each pair and close up the chain
+		for (size_t sIndex = 0; sIndex < Stores; sIndex += 2) {
+			if ((sIndex + 1) < Stores) mergeStores(sIndex, sIndex + 1, Stable, Ascending);
+			if (sIndex > 0) {
+				pStoreChain->Store[sIndex / 2] = pStoreChain->Store[sIndex];
+				pStoreChain->Store[sIndex] = nullptr;
+			}
+		}
+		Stores = (Stores + 1) / 2;
+		for (size_t sIndex = 0; sIndex < Stores; sIndex++) setBoundaries(sIndex);
+
+		//  Accumulate the time spent
+		Stats.finishPM(pStoreChain->StoreCount - Stores);
+
+		//  Update the store count, the last store to receive a key is no longer known
+		pStoreChain->StoreCount = Stores;
+		LastStore = Stores;
+
+		//  Return to caller
+		return;
+	}
+
+	//  suppressTiered
+	//
+	//  This function will perform a preemptive merge on the current splitter store chain.
+	//  The merge pattern repeatedly merges the adjacent pair of stores holding the fewest records until m/n of the
+	//  total store chain has been merged.
+	//
+	//  PARAMETERS:
+	//
+	//		bool		-		true if the keys are stable
+	//		bool		-		true if the sequence is ascending false if descending (stable only)
+	// 
+	//  RETURNS:
+	//
+	//  NOTES:
+	// 
+
+	void	suppressTiered(bool Stable, bool Ascending) {
+		size_t				Stores = pStoreChain->StoreCount;								//  Current number of stores
+		size_t				Merges = PMP.getMerges(Stores);									//  Stores to be merged
+		size_t				FirstChanged = Stores;											//  First store with changed bounds
+
+		//  Record start time
+		Stats.startPM();
+
+		for (size_t mIndex = 0; mIndex < Merges; mIndex++) {
+			size_t			Best = 0;														//  Smallest adjacent pair
+
+			//  Find the adjacent pair with the fewest records
+			for (size_t sIndex = 1; (sIndex + 1) < Stores; sIndex++) {
+				if ((pStoreChain->Store[sIndex]->SRANum + pStoreChain->Store[sIndex + 1]->SRANum) <
+					(pStoreChain->Store[Best]->SRANum + pStoreChain->Store[Best + 1]->SRANum)) Best = sIndex;
+			}
+
+			//  Merge the pair and close up the chain
+			mergeStores(Best, Best + 1, Stable, Ascending);
+			for (size_t sIndex = Best + 1; (sIndex + 1) < Stores; sIndex++) pStoreChain->Store[sIndex] = pStoreChain->Store[sIndex + 1];
+			pStoreChain->Store[Stores - 1] = nullptr;
+			Stores--;
+			if (Best < FirstChanged) FirstChanged = Best;
+		}
+		for (size_t sIndex = FirstChanged; sIndex < Stores; sIndex++) setBoundaries(sIndex);
+
+		//  Accumulate the time spent
+		Stats.finishPM(pStoreChain->StoreCount - Stores);
+
+		//  Update the store count, the last store to receive a key is no longer known
+		pStoreChain->StoreCount = Stores;
+		LastStore = Stores;
+
+		//  Return to caller
+		return;
+	}
+
+	//  suppressTiers
+	//
+	//  This function will perform a preemptive merge on the current splitter store chain.
+	//  The merge pattern is size tiered (LSM) compaction, the shortest run of stores at the tail of the chain that
+	//  holds more than N stores of its largest tier is merged into a single store.
+	//
+	//  PARAMETERS:
+	//
+	//		bool		-		true if the keys are stable
+	//		bool		-		true if the sequence is ascending false if descending (stable only)
+	// 
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+	//	1.	Only adjacent stores can be merged, smaller stores lying between the stores of a full tier are merged
+	//		with them.
+	//	2.	The merged store may complete a run in the next tier, so the merges cascade up the chain until no run
+	//		at the tail holds more than N stores of its largest tier.
+	//	3.	Smaller stores lying between the stores of a full tier are not limited, when the store count trigger
+	//		(backstop) fires with no tier full m/n of the chain is swept up from the tail as for the tail strategy.
+	// 
+
+	void	suppressTiers(bool Stable, bool Ascending) {
+		size_t				Stores = pStoreChain->StoreCount;								//  Current number of stores
+		size_t				FirstChanged = Stores;											//  First store with changed bounds
+		size_t				Start = findTierRun(Stores);									//  Start of the run to merge
+
+		//  Record start time
+		Stats.startPM();
+
+		//  Merge the tail runs until no tier is full
+		while (Start < Stores) {
+			mergeStoreRange(&pStoreChain->Store[Start], Stores - Start, Stable, Ascending);
+			Stores = Start + 1;
+			FirstChanged = Start;
+			Start = findTierRun(Stores);
+		}
+
+		//  Backstop - sweep up m/n of the chain from the tail
+		if (Stores == pStoreChain->StoreCount && Stores > 1) {
+			size_t			Merges = PMP.getMerges(Stores);									//  Stores to be merged
+
+			mergeStoreRange(&pStoreChain->Store[Stores - (Merges + 1)], Merges + 1, Stable, Ascending);
+			Stores = Stores - Merges;
+			FirstChanged = Stores - 1;
+		}
+		for (size_t sIndex = FirstChanged; sIndex < Stores; sIndex++) setBoundaries(sIndex);
+
+		//  Accumulate the time spent
+		Stats.finishPM(pStoreChain->StoreCount - Stores);
+
+		//  Update the store count, the last store to receive a key is no longer known
+		pStoreChain->StoreCount = Stores;
+		LastStore = Stores;
+
+		//  Return to caller
+		return;
+	}
+
+	//  mergeStores
+	//
+	//  This function will merge a store into a preceding store on the chain, the stores between them MUST already
+	//  have been merged into the target.
+	//
+	//  PARAMETERS:
+	//
+	//		size_t		-		Index of the target store
+	//		size_t		-		Index of the store to be merged into the target
+	//		bool		-		true if the keys are stable
+	//		bool		-		true if the sequence is ascending false if descending (stable only)
+	// 
+	//  RETURNS:
+	//
+	//  NOTES:
+	// 
+
+	void	mergeStores(size_t Target, size_t Mergee, bool Stable, bool Ascending) {
+
+#ifdef INSTRUMENTED
+		Stats.startStoreMerge(int(pStoreChain->Store[Target]->SRANum), int(pStoreChain->Store[Mergee]->SRANum));
+#endif
+		pStoreChain->Store[Target]->mergeNextStore(pStoreChain->Store[Mergee], nullptr, Stable && !Ascending);
+		pStoreChain->Store[Mergee] = nullptr;
+
+		//  Return to caller
+		return;
+	}
+
+	//  mergeStoreRange
+	//
+	//  This function will merge a contiguous range of stores into the first store of the range.
+	//
+	//  PARAMETERS:
+	//
+	//		SplitStore**	-		Pointer to the first store (target) of the range
+	//		size_t			-		Number of stores in the range
+	//		bool			-		true if the keys are stable
+	//		bool			-		true if the sequence is ascending false if descending (stable only)
+	// 
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+	//	1.	The range is merged either in a single k-way pass (every record is copied once at a cost of log2(k)
+	//		comparisons) or pairwise from the tail (the accumulated tail is copied at every merge), whichever
+	//		moves the fewest records. A dominant target store favours the pairwise merge.
+	//	2.	Stores with a keystore (on-disk model) are always merged pairwise, the pairwise merge compacts the
+	//		keystore arenas of small stores, the k-way merge would retain an arena for every mergee.
+	//	3.	The range need not be on the store chain, a background PM merges a range that has been detached from it.
+	// 
+
+	void	mergeStoreRange(SplitStore<T, C>** pStores, size_t Count, bool Stable, bool Ascending) {
+		size_t			Total = pStores[Count - 1]->SRANum;									//  Records in the range
+		size_t			PairCost = 0;														//  Records copied by pairwise merges
+		size_t			Ways = 1;															//  log2(k)
+
+		//  Determine the cost of the pairwise merges and of the k-way merge
+		for (size_t sIndex = Count - 1; sIndex > 0; sIndex--) {
+			Total += pStores[sIndex - 1]->SRANum;
+			PairCost += Total;
+		}
+		while ((size_t(1) << Ways) < Count) Ways++;
+
+		//  Merge pairwise from the tail when that is cheaper or the stores use a keystore
+		if ((PairCost <= (Total * Ways)) || pStores[0]->hasKeyStore()) {
+			for (size_t sIndex = Count - 1; sIndex > 0; sIndex--) {
+#ifdef INSTRUMENTED
+				Stats.startStoreMerge(int(pStores[sIndex - 1]->SRANum), int(pStores[sIndex]->SRANum));
+#endif
+				pStores[sIndex - 1]->mergeNextStore(pStores[sIndex], nullptr, Stable && !Ascending);
+				pStores[sIndex] = nullptr;
+			}
+			return;
+		}
+
+#ifdef INSTRUMENTED
+		{
+			size_t		Recs = pStores[0]->SRANum;													//  Records in the target
+
+			for (size_t sIndex = 1; sIndex < Count; sIndex++) {
+				Stats.startStoreMerge(int(Recs), int(pStores[sIndex]->SRANum));
+				Recs += pStores[sIndex]->SRANum;
+			}
+		}
+#endif
+		pStores[0]->mergeFollowingStores(pStores, Count, Stable && !Ascending);
+		for (size_t sIndex = 1; sIndex < Count; sIndex++) pStores[sIndex] = nullptr;
+
+		//  Return to caller
+		return;
+	}
+
+	//  isTierFull
+	//
+	//  Determines if a run of stores at the tail of the chain has overfilled its size tier (lsm strategy only)
+	//
+	//  PARAMETERS:
+	// 
+	//  RETURNS:
+	//
+	//		bool		-		true if a run at the tail holds more than N stores of its largest tier, otherwise false
+	//
+	//  NOTES:
+	// 
+
+	bool	isTierFull() const {
+		if (PMP.Strategy != PMP_LSM) return false;
+		return findTierRun(pStoreChain->StoreCount) < pStoreChain->StoreCount;
+	}
+
+	//  findTierRun
+	//
+	//  Finds the shortest run of stores at the tail of the chain that holds more than N stores of its largest tier
+	//
+	//  PARAMETERS:
+	//
+	//		size_t		-		Number of stores on the chain
+	// 
+	//  RETURNS:
+	//
+	//		size_t		-		Index of the first store of the run, the number of stores if no tier is full
+	//
+	//  NOTES:
+	//
+	//	1.	Stores grow after they are added to the chain, so the whole chain is examined and not only the tail tier.
+	// 
+
+	size_t	findTierRun(size_t Stores) const {
+		size_t			MaxTier = 0;														//  Largest tier in the run
+		size_t			Count = 0;															//  Stores in the largest tier
+
+		for (size_t sIndex = Stores; sIndex > 0; sIndex--) {
+			size_t		Tier = PMP.getTier(pStoreChain->Store[sIndex - 1]->SRANum);		//  Tier of the store
+
+			if (Count == 0 || Tier > MaxTier) {
+				MaxTier = Tier;
+				Count = 1;
+			}
+			else if (Tier == MaxTier) Count++;
+			if (Count > PMP.TierStores) return sIndex - 1;
+		}
+		return Stores;
+	}
+
+	//  getStoreCost
+	//
+	//  Returns the memory overhead of a single store on the chain
+	//
+	//  PARAMETERS:
+	// 
+	//  RETURNS:
+	//
+	//		size_t		-		Bytes of overhead for each store (header, initial SRA and index entries)
+	//
+	//  NOTES:
+	// 
+
+	size_t	getStoreCost() const { return sizeof(SplitStore<T, C>) + (256 * sizeof(T)) + sizeof(void*) + (2 * sizeof(uint64_t)); }
+
+	//  doAlternateMerge
+	//
+	//  This function will perform a final merge on the current splitter store chain.
+	//  The merge pattern is alternate stores are merged into their predecessors on the chain.
+	//
+	//  PARAMETERS:
+	// 
+	//  RETURNS:
+	//
+	//  NOTES:
+	// 
+
+	void	doAlternateMerge() {
+		int					sIndex = 0;														//  Store index
+		int					tIndex = 0;														//  Target index
+		size_t				Stores = pStoreChain->StoreCount;								//  Current number of stores
+
+		//  Process all stores
+		while (size_t(sIndex) < pStoreChain->StoreCount) {
+
+			// Merge the following splitter into the current one
+			if (size_t(sIndex + 1) < pStoreChain->StoreCount) {
+#ifdef INSTRUMENTED
+				Stats.startStoreMerge(int(pStoreChain->Store[sIndex]->SRANum), int(pStoreChain->Store[sIndex + 1]->SRANum));
+#endif
+				pStoreChain->Store[sIndex]->mergeNextStore(pStoreChain->Store[sIndex + 1]);
+				pStoreChain->Store[sIndex + 1] = nullptr;
+				Stores--;
+			}
+
+			if (tIndex > 0) {
+				pStoreChain->Store[tIndex] = pStoreChain->Store[sIndex];
+				pStoreChain->Store[sIndex] = nullptr;
+			}
+			//  Move on to the next pair
+			sIndex += 2;
+			tIndex++;
+		}
+
+		pStoreChain->StoreCount = Stores;
 
 		//  Return to caller
 		return;
@@ -1701,77 +3118,268 @@ private:
 	//
 	//  PARAMETERS:
 	//
-	//		bool		-		true if the sequence is ascending false if descending
+	//		bool		-		true if the sequence is ascending false if descending
+	// 
+	//  RETURNS:
+	//
+	//  NOTES:
+	// 
+
+	void	doStableAlternateMerge(bool Ascending) {
+		int					sIndex = 0;														//  Store index
+		int					tIndex = 0;														//  Target index
+		size_t				Stores = pStoreChain->StoreCount;								//  Current number of stores
+
+		//  Process all stores
+		while (size_t(sIndex) < pStoreChain->StoreCount) {
+
+			// Merge the following splitter into the current one
+			if (size_t(sIndex + 1) < pStoreChain->StoreCount) {
+#ifdef INSTRUMENTED
+				Stats.startStoreMerge(int(pStoreChain->Store[sIndex]->SRANum), int(pStoreChain->Store[sIndex + 1]->SRANum));
+#endif
+				pStoreChain->Store[sIndex]->mergeNextStore(pStoreChain->Store[sIndex + 1], nullptr, !Ascending);
+				pStoreChain->Store[sIndex + 1] = nullptr;
+				Stores--;
+			}
+
+			if (tIndex > 0) {
+				pStoreChain->Store[tIndex] = pStoreChain->Store[sIndex];
+				pStoreChain->Store[sIndex] = nullptr;
+			}
+			//  Move on to the next pair
+			sIndex += 2;
+			tIndex++;
+		}
+
+		pStoreChain->StoreCount = Stores;
+
+		//  Return to caller
+		return;
+	}
+
+	//  doParallelAlternateMerge
+	//
+	//  This function will perform a single round of the final merge on the current splitter store chain.
+	//  The merge pattern is the same as the single threaded variants, alternate stores are merged into their predecessors,
+	//  however the pair merges within the round are performed concurrently by the final merge worker pool.
+	//
+	//  PARAMETERS:
+	//
+	//		bool		-		true if the keys are stable
+	//		bool		-		true if the sequence is ascending false if descending (stable only)
+	// 
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+	//	1.	Each pair merge only touches the two stores involved so no locking is needed between the tasks.
+	//	2.	In the last rounds there are fewer pairs than threads, the large merges are then partitioned (merge-path).
+	// 
+
+	void	doParallelAlternateMerge(bool Stable, bool Ascending) {
+		size_t				Pairs = pStoreChain->StoreCount / 2;							//  Number of pairs to merge
+		size_t				Stores = pStoreChain->StoreCount;								//  Current number of stores
+
+#ifdef INSTRUMENTED
+		//  Instrumentation is recorded from the dispatching thread
+		for (size_t pIndex = 0; pIndex < Pairs; pIndex++) {
+			Stats.startStoreMerge(int(pStoreChain->Store[2 * pIndex]->SRANum), int(pStoreChain->Store[(2 * pIndex) + 1]->SRANum));
+		}
+#endif
+
+		//  Merge a pair of stores, optionally partitioning the merge itself across the pool
+		auto	mergePair = [this, Stable, Ascending](size_t pIndex, WorkerPool* pPool) {
+			SplitStore<T, C>* pTarget = pStoreChain->Store[2 * pIndex];
+			SplitStore<T, C>* pMergee = pStoreChain->Store[(2 * pIndex) + 1];
+
+			pTarget->mergeNextStore(pMergee, pPool, Stable && !Ascending);
+		};
+
+		if (Pairs >= pMergePool->getThreads()) {
+			//  Enough pairs to occupy the pool - merge all of the pairs concurrently
+			pMergePool->dispatch(Pairs, [&mergePair](size_t pIndex) { mergePair(pIndex, nullptr); });
+		}
+		else {
+			//  Too few pairs to occupy the pool - merge each pair in turn, partitioning the large merges across the pool
+			for (size_t pIndex = 0; pIndex < Pairs; pIndex++) {
+				if ((pStoreChain->Store[2 * pIndex]->SRANum + pStoreChain->Store[(2 * pIndex) + 1]->SRANum) >= MergePathMin) mergePair(pIndex, pMergePool);
+				else mergePair(pIndex, nullptr);
+			}
+		}
+
+		//  Compact the store chain
+		for (size_t sIndex = 0; sIndex < Stores; sIndex += 2) {
+			pStoreChain->Store[sIndex / 2] = pStoreChain->Store[sIndex];
+			if (sIndex > 0) pStoreChain->Store[sIndex] = nullptr;
+			if ((sIndex + 1) < Stores) pStoreChain->Store[sIndex + 1] = nullptr;
+		}
+
+		pStoreChain->StoreCount = Stores - Pairs;
+
+		//  Return to caller
+		return;
+	}
+
+	//  doSizedMerge
+	//
+	//  This function will perform a final merge on the current splitter store chain.
+	//  The merge pattern is that the adjacent pair of stores with the fewest records is merged next, until a single
+	//  store remains. Small stores are merged with each other before they are merged into the large (head) stores,
+	//  so each large store is copied in fewer merges than with the alternate pattern.
+	//
+	//  PARAMETERS:
+	//
+	//		bool		-		true if the keys are stable
+	//		bool		-		true if the sequence is ascending false if descending (stable only)
 	// 
 	//  RETURNS:
 	//
+	//		size_t		-		Number of records moved by the merges
+	//
 	//  NOTES:
+	//
+	//	1.	Only adjacent stores are merged so the nesting of the key ranges and the stable ordering are preserved.
+	//	2.	The merges are not made in rounds so the final merge buffers are not used, the merges are made one at a
+	//		time and a large merge is partitioned across the final merge worker pool (if any).
 	// 
 
-	void	doStableAlternateMerge(bool Ascending) {
-		int					sIndex = 0;														//  Store index
-		int					tIndex = 0;														//  Target index
+	size_t	doSizedMerge(bool Stable, bool Ascending) {
 		size_t				Stores = pStoreChain->StoreCount;								//  Current number of stores
+		size_t				Moves = 0;														//  Records moved
 
-		//  Process all stores
-		while (size_t(sIndex) < pStoreChain->StoreCount) {
+		while (Stores > 1) {
+			size_t			Best = 0;														//  Smallest adjacent pair
+			size_t			PairRecs = 0;													//  Records in the pair
+			WorkerPool*		pPool = nullptr;												//  Pool for a partitioned merge
 
+			//  Find the adjacent pair with the fewest records
+			for (size_t sIndex = 1; (sIndex + 1) < Stores; sIndex++) {
+				if ((pStoreChain->Store[sIndex]->SRANum + pStoreChain->Store[sIndex + 1]->SRANum) <
+					(pStoreChain->Store[Best]->SRANum + pStoreChain->Store[Best + 1]->SRANum)) Best = sIndex;
+			}
+			PairRecs = pStoreChain->Store[Best]->SRANum + pStoreChain->Store[Best + 1]->SRANum;
+			if (PairRecs >= MergePathMin) pPool = pMergePool;
+
+			//  Merge the pair
 #ifdef INSTRUMENTED
-			Stats.startStoreMerge(int(pStoreChain->Store[sIndex]->SRANum), int(pStoreChain->Store[sIndex + 1]->SRANum));
+			Stats.startStoreMerge(int(pStoreChain->Store[Best]->SRANum), int(pStoreChain->Store[Best + 1]->SRANum));
 #endif
-			// Merge the following splitter into the current one
-			if (size_t(sIndex + 1) < pStoreChain->StoreCount) {
-				if (Ascending) pStoreChain->Store[sIndex]->mergeNextStoreAscending(pStoreChain->Store[sIndex + 1]);
-				else pStoreChain->Store[sIndex]->mergeNextStoreDescending(pStoreChain->Store[sIndex + 1]);
-				pStoreChain->Store[sIndex + 1] = nullptr;
-				Stores--;
-			}
+			pStoreChain->Store[Best]->mergeNextStore(pStoreChain->Store[Best + 1], pPool, Stable && !Ascending);
+			Moves += PairRecs;
 
-			if (tIndex > 0) {
-				pStoreChain->Store[tIndex] = pStoreChain->Store[sIndex];
-				pStoreChain->Store[sIndex] = nullptr;
-			}
-			//  Move on to the next pair
-			sIndex += 2;
-			tIndex++;
+			//  Close up the chain
+			for (size_t sIndex = Best + 1; (sIndex + 1) < Stores; sIndex++) pStoreChain->Store[sIndex] = pStoreChain->Store[sIndex + 1];
+			pStoreChain->Store[Stores - 1] = nullptr;
+			Stores--;
 		}
 
 		pStoreChain->StoreCount = Stores;
 
-		//  Return to caller
-		return;
+		//  Return the records moved
+		return Moves;
 	}
 
-	//  computeMaxStores
+	//  getAlternateMoves
 	//
-	//  Returns the new value for Maximum number of stores (preemptive merge trigger)
+	//  Returns the number of records that would be moved by a final merge of the current chain using the alternate
+	//  merge pattern
 	//
 	//  PARAMETERS:
 	// 
-	//		size_t		-		Current Max Stores
-	//		size_t		-		Current Record Count
-	//		size_t		-		Percentage of S to use
+	//  RETURNS:
+	//
+	//		size_t		-		Number of records moved
+	//
+	//  NOTES:
+	// 
+
+	size_t	getAlternateMoves() const {
+		size_t				Stores = pStoreChain->StoreCount;								//  Stores in the simulated round
+		size_t				Moves = 0;														//  Records moved
+		size_t*				pRecs = nullptr;												//  Records in each simulated store
+
+		if (Stores < 2) return 0;
+		pRecs = (size_t*)malloc(Stores * sizeof(size_t));
+		if (pRecs == nullptr) return 0;
+		for (size_t sIndex = 0; sIndex < Stores; sIndex++) pRecs[sIndex] = pStoreChain->Store[sIndex]->SRANum;
+
+		//  Simulate each round, the odd store at the tail is carried into the next round
+		while (Stores > 1) {
+			for (size_t sIndex = 0; sIndex < Stores; sIndex += 2) {
+				if ((sIndex + 1) < Stores) {
+					pRecs[sIndex / 2] = pRecs[sIndex] + pRecs[sIndex + 1];
+					Moves += pRecs[sIndex / 2];
+				}
+				else pRecs[sIndex / 2] = pRecs[sIndex];
+			}
+			Stores = (Stores + 1) / 2;
+		}
+
+		free(pRecs);
+
+		//  Return the records moved
+		return Moves;
+	}
+
+	//  prepareMergeBuffers
+	//
+	//  This function will size the final merge buffers and assign them to every store on the chain.
 	//
+	//  PARAMETERS:
+	// 
 	//  RETURNS:
+	//
+	//  NOTES:
+	//
+	//	1.	Each round of merges needs at most every record plus the head and tail padding of each merged store.
+	// 
+
+	void	prepareMergeBuffers() {
+		size_t				Records = 0;													//  Records held in the chain
+
+		//  Size the arenas
+		for (size_t sIndex = 0; sIndex < pStoreChain->StoreCount; sIndex++) Records += pStoreChain->Store[sIndex]->SRANum;
+		Buffers.setCapacity(Records + (256 * ((pStoreChain->StoreCount / 2) + 1)));
+
+		//  Assign the buffers to every store
+		for (size_t sIndex = 0; sIndex < pStoreChain->StoreCount; sIndex++) pStoreChain->Store[sIndex]->setMergeBuffers(&Buffers);
+
+		//  Return to caller
+		return;
+	}
+
+	//  startMergeRound
+	//
+	//  This function will prepare the final merge buffers for the next round of merges.
+	//
+	//  PARAMETERS:
 	// 
-	//		size_t		-		New Max Stores
+	//  RETURNS:
 	//
 	//  NOTES:
-	//  
+	//
+	//	1.	A store that was not merged in the previous round (odd store at the tail) may still be held in the arena
+	//		that is about to become the target, it is moved out of the arena before the round starts.
+	// 
 
-	size_t		computeMaxStores(size_t CMS, size_t CRC, size_t POS) {
-		size_t		NewMS = 0;															//  New Max Stores
-		size_t		CurrentS = 0;														//  Current S
+	void	startMergeRound() {
 
-		//  Compute S for the current value of n S = 2*sqrt(n/2)
-		CurrentS = size_t(ceil(sqrt(double(CRC / 2)) * 2.0));
+		//  Evacuate any store still held in the next target arena
+		for (size_t sIndex = 0; sIndex < pStoreChain->StoreCount; sIndex++) {
+			if (Buffers.isNextTarget(pStoreChain->Store[sIndex]->pSRA)) {
+				if (!pStoreChain->Store[sIndex]->relocateSRA()) {
+					std::cerr << "FATAL: Unable to relocate a store from the final merge buffers." << std::endl;
+					std::abort();
+				}
+			}
+		}
 
-		//  Compute new MaxS
-		NewMS = (CurrentS * POS) / 100;
+		//  Switch the arenas
+		Buffers.startRound();
 
-		//  Return the computed new max stores providing it is greater than the existing value
-		if (NewMS > CMS) return NewMS;
-		return CMS;
+		//  Return to caller
+		return;
 	}
 
 	//  expandStoreChain
@@ -1795,6 +3403,409 @@ private:
 			std::cerr << "FATAL: Unable to reallocate the store chain structure for: " << pStoreChain->StoreCap << " stores." << std::endl;
 			std::abort();
 		}
+		expandBoundaryIndex(pStoreChain->StoreCap);
+		return;
+	}
+
+	//  expandBoundaryIndex
+	//
+	//  This function will (re)allocate the boundary key index to hold the passed number of stores
+	//
+	//  PARAMETERS:
+	//
+	//		size_t			-		Capacity required (stores)
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+	//	1.	The low and high arrays are each aligned on a cache line, the existing boundaries are preserved.
+	//
+
+	void	expandBoundaryIndex(size_t Capacity) {
+		size_t			NewCap = (Capacity + 7) & ~size_t(7);										//  Capacity rounded to a cache line
+		void*			pNewMem = nullptr;															//  New allocation
+		uint64_t*		pNewLo = nullptr;															//  New low boundaries
+		uint64_t*		pNewHi = nullptr;															//  New high boundaries
+
+		if (NewCap <= BoundCap) return;
+
+		//  Allocate a block with space for both arrays and the alignment
+		pNewMem = malloc((2 * NewCap * sizeof(uint64_t)) + 64);
+		if (pNewMem == nullptr) {
+			std::cerr << "FATAL: Unable to allocate the boundary key index for: " << NewCap << " stores." << std::endl;
+			std::abort();
+		}
+		pNewLo = (uint64_t*)((uintptr_t(pNewMem) + 63) & ~uintptr_t(63));
+		pNewHi = pNewLo + NewCap;
+
+		//  Preserve the existing boundaries and dismiss the old index
+		if (pBoundMem != nullptr) {
+			memcpy(pNewLo, pLoBound, BoundCap * sizeof(uint64_t));
+			memcpy(pNewHi, pHiBound, BoundCap * sizeof(uint64_t));
+			free(pBoundMem);
+		}
+		pBoundMem = pNewMem;
+		pLoBound = pNewLo;
+		pHiBound = pNewHi;
+		BoundCap = NewCap;
+
+		//  Return to caller
+		return;
+	}
+
+	//  setBoundaries
+	//
+	//  This function will refresh the boundary key index entries for the designated store from the store content
+	//
+	//  PARAMETERS:
+	//
+	//		size_t			-		Index of the store in the store chain
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+
+	void	setBoundaries(size_t StoreNo) {
+		SplitStore<T, C>* pSS = pStoreChain->Store[StoreNo];
+
+		pLoBound[StoreNo] = getKeyPrefix(pSS->lowRecord(), KL);
+		pHiBound[StoreNo] = getKeyPrefix(pSS->highRecord(), KL);
 		return;
 	}
+
+	//  compareLowBound
+	//
+	//  This function will compare the new key with the low key of the designated store
+	//
+	//  PARAMETERS:
+	//
+	//		T&				-		Const reference to the new record
+	//		uint64_t		-		Key prefix of the new record
+	//		size_t			-		Index of the store in the store chain
+	//
+	//  RETURNS:
+	//
+	//		int				-		<0, 0 or >0 as the new key is below, equal to or above the low key of the store
+	//
+	//  NOTES:
+	//
+	//	1.	The store is only dereferenced when the key prefixes are equal.
+	//
+
+	int		compareLowBound(const T& NewSR, uint64_t NewPfx, size_t StoreNo) const {
+		if (NewPfx != pLoBound[StoreNo]) return (NewPfx < pLoBound[StoreNo]) ? -1 : 1;
+		return compareKeys<C>(NewSR, pStoreChain->Store[StoreNo]->lowRecord(), KL);
+	}
+
+	//  compareHighBound
+	//
+	//  This function will compare the new key with the high key of the designated store
+	//
+	//  PARAMETERS:
+	//
+	//		T&				-		Const reference to the new record
+	//		uint64_t		-		Key prefix of the new record
+	//		size_t			-		Index of the store in the store chain
+	//
+	//  RETURNS:
+	//
+	//		int				-		<0, 0 or >0 as the new key is below, equal to or above the high key of the store
+	//
+	//  NOTES:
+	//
+	//	1.	The store is only dereferenced when the key prefixes are equal.
+	//
+
+	int		compareHighBound(const T& NewSR, uint64_t NewPfx, size_t StoreNo) const {
+		if (NewPfx != pHiBound[StoreNo]) return (NewPfx < pHiBound[StoreNo]) ? -1 : 1;
+		return compareKeys<C>(NewSR, pStoreChain->Store[StoreNo]->highRecord(), KL);
+	}
+
+	//  isWithin
+	//
+	//  This function will determine if the new key is within the key range of the designated store
+	//
+	//  PARAMETERS:
+	//
+	//		T&				-		Const reference to the new record
+	//		uint64_t		-		Key prefix of the new record
+	//		size_t			-		Index of the store in the store chain
+	//		bool			-		true if the keys are stable, false otherwise
+	//		bool&			-		Set true if the key is below the range of the store, false if above
+	//
+	//  RETURNS:
+	//
+	//		bool			-		true if the key is within the range of the store, false if it is without
+	//
+	//  NOTES:
+	//
+	//	1.	A key equal to a boundary key is without the range for unstable keys and within it for stable keys.
+	//
+
+	bool	isWithin(const T& NewSR, uint64_t NewPfx, size_t StoreNo, bool Stable, bool& Below) {
+		int			Cmp = 0;																//  Comparison result
+
+		Below = true;
+#ifdef INSTRUMENTED
+		Stats.Compares++;
+#endif
+		Cmp = compareLowBound(NewSR, NewPfx, StoreNo);
+		if (Stable ? (Cmp < 0) : (Cmp <= 0)) return false;
+		Below = false;
+#ifdef INSTRUMENTED
+		Stats.Compares++;
+#endif
+		Cmp = compareHighBound(NewSR, NewPfx, StoreNo);
+		if (Stable ? (Cmp > 0) : (Cmp >= 0)) return false;
+		return true;
+	}
+
+	//  fingerSearch
+	//
+	//  This function will locate the store that is to receive the new key by searching outwards from the store that
+	//  received the last key (the finger) and add the key to it.
+	//
+	//  PARAMETERS:
+	//
+	//		T&				-		Reference to the Sort Record to be added
+	//		uint64_t		-		Key prefix of the new record
+	//		bool			-		true if the keys are stable, false otherwise
+	//		bool			-		true if the key is held in an external keystore, false otherwise
+	//
+	//  RETURNS:
+	//
+	//		bool			-		true if the key was added, false if the binary chop must be used
+	//
+	//  NOTES:
+	//
+	//	1.	The caller has already determined that the key is within the range of the first store and without the range
+	//		of the last store, the target is the first store in the chain that the key is without.
+	//	2.	An exponential search brackets the target between a store that the key is within and one that it is without,
+	//		the bracket is then closed by bisection. Keys that arrive near the previous key cost only a few compares.
+	//
+
+	bool	fingerSearch(T& NewSR, uint64_t NewPfx, bool Stable, bool External) {
+		size_t		Finger = LastStore;														//  Store that received the last key
+		size_t		Lo = 0;																	//  Store that the key is within
+		size_t		Hi = 0;																	//  Store that the key is without
+		size_t		Probe = 0;																//  Store being probed
+		size_t		Step = 1;																//  Exponential search step
+		bool		Below = false;															//  Key is below the range of Hi
+		bool		ProbeBelow = false;														//  Key is below the range of the probe
+
+		//  The finger must be a known store that is not being merged
+		if (Finger >= pStoreChain->StoreCount) return false;
+		if (Amortising && Finger >= DeferHead) return false;
+		Stats.recordFingerProbe();
+
+		if (Finger == 0 || isWithin(NewSR, NewPfx, Finger, Stable, Below)) {
+			//  The target is to the right of the finger - the last store is known to be without
+			Lo = Finger;
+			while (true) {
+				Probe = Lo + Step;
+				if (Probe > pStoreChain->StoreCount - 1) Probe = pStoreChain->StoreCount - 1;
+				if (!isWithin(NewSR, NewPfx, Probe, Stable, Below)) break;
+				Lo = Probe;
+				Step = Step * 2;
+			}
+			Hi = Probe;
+		}
+		else {
+			//  The target is the finger or to the left of it - the first store is known to be within
+			Hi = Finger;
+			while (true) {
+				Probe = (Hi > Step) ? Hi - Step : 0;
+				if (isWithin(NewSR, NewPfx, Probe, Stable, ProbeBelow)) break;
+				Hi = Probe;
+				Below = ProbeBelow;
+				Step = Step * 2;
+			}
+			Lo = Probe;
+		}
+
+		//  Close the bracket by bisection
+		while (Hi - Lo > 1) {
+			Probe = Lo + ((Hi - Lo) / 2);
+			if (isWithin(NewSR, NewPfx, Probe, Stable, ProbeBelow)) Lo = Probe;
+			else {
+				Hi = Probe;
+				Below = ProbeBelow;
+			}
+		}
+		if (Hi == Finger) Stats.recordFingerHit();
+
+		//  Add the key to the target store
+		if (Below) {
+			if (External) pStoreChain->Store[Hi]->addLowExternalKey(NewSR);
+			else pStoreChain->Store[Hi]->addLowKey(NewSR);
+			setLowBound(Hi, NewPfx);
+		}
+		else {
+			if (External) pStoreChain->Store[Hi]->addHighExternalKey(NewSR);
+			else pStoreChain->Store[Hi]->addHighKey(NewSR);
+			setHighBound(Hi, NewPfx);
+		}
+#ifdef INSTRUMENTED
+		if (Below) Stats.LoHits++;
+		else Stats.HiHits++;
+		//  Increment the new key counter - if this triggered a stats reporting interval then do the pile-up reporting
+		if (Stats.newKey()) {
+			if (Stats.isPileUpInstrumentActive()) {
+				Stats.writePileUpLeader();
+				for (Probe = 0; Probe < pStoreChain->StoreCount; Probe++) {
+					Stats.writePileUpStore(int(pStoreChain->Store[Probe]->SRANum), Probe == pStoreChain->StoreCount - 1);
+				}
+			}
+		}
+#endif
+		return true;
+	}
+
+	//  setLowBound
+	//
+	//  This function will record a new low key for the designated store
+	//
+	//  PARAMETERS:
+	//
+	//		size_t			-		Index of the store in the store chain
+	//		uint64_t		-		Key prefix of the new low key
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+
+	void	setLowBound(size_t StoreNo, uint64_t NewPfx) { pLoBound[StoreNo] = NewPfx; LastStore = StoreNo; return; }
+
+	//  setHighBound
+	//
+	//  This function will record a new high key for the designated store
+	//
+	//  PARAMETERS:
+	//
+	//		size_t			-		Index of the store in the store chain
+	//		uint64_t		-		Key prefix of the new high key
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+
+	void	setHighBound(size_t StoreNo, uint64_t NewPfx) { pHiBound[StoreNo] = NewPfx; LastStore = StoreNo; return; }
+
+	//  setBounds
+	//
+	//  This function will record the single key of a new store
+	//
+	//  PARAMETERS:
+	//
+	//		size_t			-		Index of the store in the store chain
+	//		uint64_t		-		Key prefix of the key
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+
+	void	setBounds(size_t StoreNo, uint64_t NewPfx) { pLoBound[StoreNo] = pHiBound[StoreNo] = NewPfx; LastStore = StoreNo; return; }
+
+	//  extendRun
+	//
+	//  This function will append the run of records that follows the last key added to the store that received it.
+	//  Records are taken from the passed array for as long as each one would be placed by add() (or addStableKey())
+	//  at the same end of the same store as the one before it, the run is then added to the store in a single copy.
+	//
+	//  PARAMETERS:
+	//
+	//		T*				-		Pointer to the records that follow the last key added
+	//		size_t			-		Number of records available
+	//		bool			-		true if the keys are stable, false otherwise
+	//
+	//  RETURNS:
+	//
+	//		size_t			-		Number of records added to the store
+	//
+	//  NOTES:
+	//
+	//	1.	The placement is identical to adding the records one at a time, only the binary chop is avoided.
+	//	2.	An ascending run is appended to the high end, a descending run is prepended (reversed) to the low end.
+	//
+
+	size_t	extendRun(T* pRun, size_t Max, bool Stable) {
+		size_t			S = LastStore;																//  Store that received the last key
+		size_t			RunLen = 0;																	//  Length of the run
+		uint64_t		Pfx = 0;																	//  Key prefix of the current record
+		int				Cmp = 0;																	//  Comparison result
+		bool			High = false;																//  Run is appended to the high end
+
+		if (Max == 0 || S >= pStoreChain->StoreCount) return 0;
+		if (Amortising && S >= DeferHead) return 0;
+
+		//  Determine if the first record would be placed at either end of the store
+		Pfx = getKeyPrefix(pRun[0], KL);
+		if (Stable) {
+			if (compareLowBound(pRun[0], Pfx, S) < 0) {
+				if (S > 0 && compareLowBound(pRun[0], Pfx, S - 1) < 0) return 0;
+				High = false;
+			}
+			else {
+				if (compareHighBound(pRun[0], Pfx, S) <= 0) return 0;
+				if (S > 0 && compareHighBound(pRun[0], Pfx, S - 1) > 0) return 0;
+				High = true;
+			}
+		}
+		else {
+			if (compareLowBound(pRun[0], Pfx, S) <= 0) {
+				if (S > 0 && compareLowBound(pRun[0], Pfx, S - 1) <= 0) return 0;
+				High = false;
+			}
+			else {
+				if (compareHighBound(pRun[0], Pfx, S) < 0) return 0;
+				if (S > 0 && compareHighBound(pRun[0], Pfx, S - 1) >= 0) return 0;
+				High = true;
+			}
+		}
+
+		//  Extend the run while each record continues the sequence and remains within the range of the previous store
+		for (RunLen = 1; RunLen < Max; RunLen++) {
+			Cmp = compareKeys<C>(pRun[RunLen], pRun[RunLen - 1], KL);
+			if (High) {
+				if (Stable ? (Cmp <= 0) : (Cmp < 0)) break;
+				if (S > 0) {
+					Cmp = compareHighBound(pRun[RunLen], getKeyPrefix(pRun[RunLen], KL), S - 1);
+					if (Stable ? (Cmp > 0) : (Cmp >= 0)) break;
+				}
+			}
+			else {
+				if (Stable ? (Cmp >= 0) : (Cmp > 0)) break;
+				if (S > 0) {
+					Cmp = compareLowBound(pRun[RunLen], getKeyPrefix(pRun[RunLen], KL), S - 1);
+					if (Stable ? (Cmp < 0) : (Cmp <= 0)) break;
+				}
+			}
+		}
+
+		//  Add the run to the store in a single block
+		if (High) {
+			pStoreChain->Store[S]->addHighKeys(pRun, RunLen);
+			pHiBound[S] = getKeyPrefix(pRun[RunLen - 1], KL);
+		}
+		else {
+			pStoreChain->Store[S]->addLowKeys(pRun, RunLen);
+			pLoBound[S] = getKeyPrefix(pRun[RunLen - 1], KL);
+		}
+
+		//  Account for the keys
+		RecNo += RunLen;
+		for (size_t kIndex = 0; kIndex < RunLen; kIndex++) Stats.newKey();
+#ifdef INSTRUMENTED
+		if (High) Stats.HiHits += RunLen;
+		else Stats.LoHits += RunLen;
+#endif
+
+		//  Return the length of the run
+		return RunLen;
+	}
 };
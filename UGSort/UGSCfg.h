@@ -3,7 +3,7 @@
 //*																													*
 //*   File:       UGSCfg.h																							*
 //*   Suite:      Experimental Algorithms																			*
-//*   Version:    1.17.0	(Build: 20)																				*
+//*   Version:    1.42.0	(Build: 46)																				*
 //*   Author:     Ian Tree/HMNL																						*
 //*																													*
 //*   Copyright 2017 - 2026 Ian J. Tree.																			*
@@ -27,13 +27,40 @@
 //*		-----------------																							*
 //*																													*
 //*		<sort inmem="true|false" ondisk="true|false" pm="enable|disable" maxsplitters="s" maxinc="i"				*
-//*			maxrecl="l>																								*
+//*			maxrecl="l" threads="t" mpmin="m" streamfm="true|false" keyprefix="true|false"							*
+//*			runs="true|false" partitioned="true|false" sizedfm="true|false"											*
+//*			chunked="true|false" pmpolicy="p" pmmerge="pm" pmcount="pn" pmbudget="b"								*
+//*			pmbackground="true|false" pmquantum="q" pmtier="n" pmratio="f" finger="true|false"						*
+//*			records="standard|pointer|index" isa="l" commonprefix="true|false">										*
 //*																													*
 //*			This section contains the parameters that control the sort												*
 //*			inmem and ondisk are mutually exclusive. If neither is specified then sort input file size and			*
 //*			key length will determine which is in effect.															*
 //*			preemptive merging (pm) is enabled by default so pm="disable" will disable it							*
+//*			where s is the number of stores that triggers the first PM (default: 100)								*
+//*			where i is the percentage of 2*sqrt(n/2) stores that triggers the following PMs (default: 25)			*
+//*			where p is the PM strategy: tail, head, alternate, tiered, budget or lsm (default: tail)				*
+//*			where pm/pn is the fraction of the stores that are merged by each PM (default: 1/10)					*
+//*			where b is the store overhead budget (MB) that triggers a PM for the budget strategy (default: 16)		*
+//*			pmbackground="true" merges the tail in a background thread (tail and budget, in-memory only)			*
+//*			where q is the records moved per insertion by an amortised tail PM (default: 0, not amortised)			*
+//*			where n is the number of adjacent stores allowed in a tier by the lsm strategy (default: 4)				*
+//*			where f is the size ratio between the tiers of the lsm strategy (default: 4)							*
 //*			where l is the maximum record length (default: 16kB)													*
+//*			where t is the number of threads to use for the final merge (default: 1, 0 = all available cores)		*
+//*			where m is the minimum number of records in a single merge for it to be split across the threads		*
+//*			(default: 1000000)																						*
+//*			streamfm="true" streams a k-way final merge of all stores directly into the sort output					*
+//*			sizedfm="true" merges the adjacent pair of stores with the fewest records next in the final merge		*
+//*			keyprefix="true" holds the first 8 bytes of the key inline in each sort record							*
+//*			runs="true" detects runs in the (in-memory) sort input and adds each run to its store in one copy		*
+//*			partitioned="true" range partitions an in-memory sort, one partition is sorted on each thread			*
+//*			chunked="true" splits an in-memory sort into contiguous chunks, one chunk is sorted on each thread		*
+//*			finger="true" searches for the store to receive each key outwards from the previous key's store			*
+//*			records="pointer" uses compact sort records that hold only a pointer to the key (8 bytes in-memory)		*
+//*			records="index" uses compact sort records that hold only the offset of the record (4 or 5 bytes)		*
+//*			where l is the kernel level: auto, scalar, sse4.2, avx2 or avx512 (default: auto)						*
+//*			commonprefix="true" eliminates the prefix common to every sort key, only the remainder is compared		*
 //*																													*
 //*			<sortin>i</sortin>																						*
 //*																													*
@@ -96,11 +123,34 @@
 //*			-maxrecl:l		Specifies the maximum record length (default: 16kB)										*
 //*			-inmem			Use in-memory sorting model																*
 //*			-ondisk			Use on-disk sorting model																*
+//*			-pms:s			Specifies the maximum number of splitters allowed before PM is triggered				*
+//*			-pmi:i			Specifies the percentage of 2*sqrt(n/2) splitters that triggers the following PMs		*
+//*			-pmm:m			Specifies the merge count of the preemptive merge pattern								*
+//*			-pmn:n			Specifies the count of the preemptive merge pattern, pm will merge m/n splitters		*
+//*			-pmp:p			Specifies the PM strategy: tail, head, alternate, tiered, budget or lsm					*
+//*			-pmb:b			Specifies the store overhead budget (MB) for the budget PM strategy						*
+//*			-pmbg			Merges the tail in a background thread (tail and budget PM strategies, in-memory only)	*
+//*			-pmq:q			Amortises the tail PM, each insertion moves at most q records (in-memory only)			*
+//*			-pmt:n			Specifies the number of adjacent stores allowed in a tier for the lsm PM strategy		*
+//*			-pmr:f			Specifies the size ratio between tiers for the lsm PM strategy							*
 //*			-skoffset:o		Specifies the offset in the records to the sort key										*
 //*			-sklen:l		Specifies the length of the sort key													*
 //*			-ska			Specifies that the sort sequence is ascending											*
 //*			-skd			Specifies that the sort sequence is descending											*
 //*			-sks			Specifies that the record sequence is preserved (stable) for identical keys				*
+//*			-threads:t		Specifies the number of threads to use for the final merge (0 = all cores)				*
+//*			-mpmin:m		Specifies the minimum records in a single merge for it to be split across threads		*
+//*			-sfm			Streams a k-way final merge directly into the sort output								*
+//*			-sizedfm		Final merge always merges the adjacent pair of stores with the fewest records next		*
+//*			-skp			Holds the first 8 bytes of the key inline in each sort record							*
+//*			-runs			Detects runs in the (in-memory) sort input and adds each run in one copy				*
+//*			-part			Range partitions an in-memory sort, one partition is sorted on each thread				*
+//*			-chunked		Splits an in-memory sort into contiguous chunks, one chunk is sorted on each thread		*
+//*			-finger			Searches for the store to receive each key outwards from the previous key's store		*
+//*			-srp			Uses compact sort records that hold only a pointer to the key (8 bytes in-memory)		*
+//*			-sri			Uses compact sort records that hold only the offset of the record (4 or 5 bytes)		*
+//*			-isa:l			Forces the kernel level: auto, scalar, sse4.2, avx2 or avx512 (default: auto)			*
+//*			-skcp			Eliminates the prefix common to every sort key, only the remainder is compared			*
 //*																													*
 //*******************************************************************************************************************
 //*																													*
@@ -110,6 +160,22 @@
 //*	1.3.0 -		08/03/2023	-	Adaptive PM																			*
 //*	1.5.0 -		13/03/2023	-	SS3 structure changes																*
 //*	1.17.0 -	28/01/2026	-	Include instrumentation package														*
+//*	1.18.0 -	16/10/2026	-	Multi-threaded final merge															*
+//*	1.19.0 -	16/10/2026	-	Merge-path partitioned merges														*
+//*	1.20.0 -	16/10/2026	-	Streamed k-way (loser tree) final merge												*
+//*	1.22.0 -	16/10/2026	-	Inline key prefix in sort records													*
+//*	1.25.0 -	16/10/2026	-	Natural run detection with bulk insertion											*
+//*	1.26.0 -	16/10/2026	-	Range partitioned parallel sort														*
+//*	1.27.0 -	16/10/2026	-	Chunk parallel sort with store adoption												*
+//*	1.28.0 -	16/10/2026	-	Selectable preemptive merge policy													*
+//*	1.30.0 -	16/10/2026	-	Size ordered final merge schedule													*
+//*	1.31.0 -	16/10/2026	-	Background preemptive merge															*
+//*	1.32.0 -	16/10/2026	-	Amortised preemptive merge															*
+//*	1.33.0 -	16/10/2026	-	Size tiered store compaction														*
+//*	1.36.0 -	16/10/2026	-	Finger search of the store chain													*
+//*	1.37.0 -	16/10/2026	-	Compact sort record formats															*
+//*	1.40.0 -	16/10/2026	-	Runtime processor feature dispatch													*
+//*	1.42.0 -	16/10/2026	-	Common sort key prefix elimination													*
 //*																													*
 //*******************************************************************************************************************/
 
@@ -118,6 +184,8 @@
 
 //  Application headers
 #include	"IStats.h"
+#include	"PMPolicy.h"																	//  Preemptive merge policy
+#include	"CPUDispatch.h"																	//  Processor feature dispatch
 
 constexpr		size_t		DEFAULT_SORTKEY_LENGTH = 32;									//  Default sort key length
 
@@ -163,6 +231,19 @@ public:
 		SKOff = 0;															//  Key Offset is start of record
 		SKLen = 0;															//  Key length MUST be specified
 		KSS = false;														//  Record sequence is NOT maintained for identical keys
+		Threads = 1;														//  Final merge is single threaded
+		MPMin = 1000000;													//  Minimum records in a partitioned merge
+		SFM = false;														//  Final merge is NOT streamed
+		SzFM = false;														//  Final merge is NOT size ordered
+		SKP = false;														//  No inline key prefix
+		Runs = false;														//  No run detection
+		Part = false;														//  Not partitioned
+		Chunked = false;													//  Not chunked
+		Finger = false;														//  Stores are located by the binary chop
+		PtrRecs = false;													//  Standard sort records
+		IdxRecs = false;													//  Standard sort records
+		ISA = ISA_AUTO;														//  Highest detected kernel level
+		CPfx = false;														//  Full sort key is compared
 #ifdef INSTRUMENTED
 		Instruments = 0;													//  No instruments active
 		Interval = 0;														//  Reporting interval
@@ -477,6 +558,223 @@ public:
 
 	bool	isPMEnabled() const { return PMEn; }
 
+	//  getPMPolicy
+	//
+	//  This function will return the preemptive merge policy (strategy and tuning) to be applied.
+	//
+	//	PARAMETERS:
+	//
+	//	RETURNS:
+	//
+	//		PMPolicy&	-		Const reference to the PM policy
+	//
+	//	NOTES:
+	//
+
+	const PMPolicy& getPMPolicy() const { return PMP; }
+
+	//  getThreads
+	//
+	//  This function will return the number of threads to be used for the final merge.
+	//
+	//	PARAMETERS:
+	//
+	//	RETURNS:
+	//
+	//		size_t		-		Number of threads, 0 = all available cores
+	//
+	//	NOTES:
+	//
+
+	size_t	getThreads() const { return Threads; }
+
+	//  getMergePathThreshold
+	//
+	//  This function will return the minimum number of records in a single merge for it to be partitioned across threads.
+	//
+	//	PARAMETERS:
+	//
+	//	RETURNS:
+	//
+	//		size_t		-		Minimum number of records
+	//
+	//	NOTES:
+	//
+
+	size_t	getMergePathThreshold() const { return MPMin; }
+
+	//  isStreamedMerge
+	//
+	//  This function will return the indicator that the final merge is streamed (k-way) into the sort output.
+	//
+	//	PARAMETERS:
+	//
+	//	RETURNS:
+	//
+	//		bool		-		true if the final merge is streamed, otherwise false
+	//
+	//	NOTES:
+	//
+
+	bool	isStreamedMerge() const { return SFM; }
+
+	//  isSizedMerge
+	//
+	//  This function will return the indicator that the final merge always merges the smallest adjacent pair of stores next.
+	//
+	//	PARAMETERS:
+	//
+	//	RETURNS:
+	//
+	//		bool		-		true if the final merge is size ordered, otherwise false
+	//
+	//	NOTES:
+	//
+	//	1.	Has no effect on a streamed final merge.
+	//
+
+	bool	isSizedMerge() const { return SzFM; }
+
+	//  isKeyPrefixEnabled
+	//
+	//  This function will return the indicator that the sort records hold an inline key prefix.
+	//
+	//	PARAMETERS:
+	//
+	//	RETURNS:
+	//
+	//		bool		-		true if the key prefix is held in the sort records, otherwise false
+	//
+	//	NOTES:
+	//
+
+	bool	isKeyPrefixEnabled() const { return SKP; }
+
+	//  isRunInsertion
+	//
+	//  This function will return the indicator that runs in the sort input are detected and added in a single copy.
+	//
+	//	PARAMETERS:
+	//
+	//	RETURNS:
+	//
+	//		bool		-		true if run insertion is enabled, otherwise false
+	//
+	//	NOTES:
+	//
+
+	bool	isRunInsertion() const { return Runs; }
+
+	//  isPartitioned
+	//
+	//  This function will return the indicator that an in-memory sort is range partitioned across the threads.
+	//
+	//	PARAMETERS:
+	//
+	//	RETURNS:
+	//
+	//		bool		-		true if the sort is partitioned, otherwise false
+	//
+	//	NOTES:
+	//
+
+	bool	isPartitioned() const { return Part; }
+
+	//  isChunked
+	//
+	//  This function will return the indicator that an in-memory sort is split into contiguous chunks across the threads.
+	//
+	//	PARAMETERS:
+	//
+	//	RETURNS:
+	//
+	//		bool		-		true if the sort is chunked, otherwise false
+	//
+	//	NOTES:
+	//
+	//	1.	A range partitioned sort takes precedence over a chunked sort.
+	//
+
+	bool	isChunked() const { return Chunked; }
+
+	//  isFingerSearch
+	//
+	//  This function will return the indicator that the store chain is searched outwards from the store that received
+	//  the previous key.
+	//
+	//	PARAMETERS:
+	//
+	//	RETURNS:
+	//
+	//		bool		-		true if finger search is enabled, otherwise false
+	//
+	//	NOTES:
+	//
+
+	bool	isFingerSearch() const { return Finger; }
+
+	//  isPointerRecords
+	//
+	//  This function will return the indicator that compact sort records holding only a pointer to the key are used.
+	//
+	//	PARAMETERS:
+	//
+	//	RETURNS:
+	//
+	//		bool		-		true if compact pointer records are used, otherwise false
+	//
+	//	NOTES:
+	//
+
+	bool	isPointerRecords() const { return PtrRecs; }
+
+	//  isIndexRecords
+	//
+	//  This function will return the indicator that compact sort records holding only the offset of the record are used.
+	//
+	//	PARAMETERS:
+	//
+	//	RETURNS:
+	//
+	//		bool		-		true if compact index records are used, otherwise false
+	//
+	//	NOTES:
+	//
+	//	1.	Only in-memory sorts use index records, on-disk sorts use compact pointer records.
+	//
+
+	bool	isIndexRecords() const { return IdxRecs; }
+
+	//  getISALevel
+	//
+	//  This function will return the requested kernel level.
+	//
+	//	PARAMETERS:
+	//
+	//	RETURNS:
+	//
+	//		int			-		The requested kernel level (ISA_xxx), ISA_AUTO selects the highest detected level
+	//
+	//	NOTES:
+	//
+
+	int		getISALevel() const { return ISA; }
+
+	//  isCommonPrefix
+	//
+	//  This function will return the indicator that the prefix common to every sort key is eliminated.
+	//
+	//	PARAMETERS:
+	//
+	//	RETURNS:
+	//
+	//		bool		-		true if the common key prefix is eliminated, otherwise false
+	//
+	//	NOTES:
+	//
+
+	bool	isCommonPrefix() const { return CPfx; }
+
 	//  
 	//  The following functions are ONLY available if the INSTRUMENTED pre-processor symbol is defined
 	//
@@ -658,6 +956,21 @@ private:
 	size_t					SKLen;												//  Sort key length in bytes
 	bool					KSS;												//  Key (identical) sequence is stable
 
+	size_t					Threads;											//  Final merge threads (0 = all cores)
+	size_t					MPMin;												//  Minimum records in a partitioned merge
+	bool					SFM;												//  Streamed (k-way) final merge
+	bool					SzFM;												//  Size ordered final merge
+	bool					SKP;												//  Inline key prefix in the sort records
+	bool					Runs;												//  Run detection in the sort input
+	bool					Part;												//  Range partitioned in-memory sort
+	bool					Chunked;											//  Chunked in-memory sort
+	bool					Finger;												//  Finger search of the store chain
+	bool					PtrRecs;											//  Compact pointer sort records
+	bool					IdxRecs;											//  Compact index sort records
+	int						ISA;												//  Requested kernel level
+	bool					CPfx;												//  Common sort key prefix eliminated
+	PMPolicy				PMP;												//  Preemptive merge policy
+
 	//  Conditional instrumentation package
 #ifdef   INSTRUMENTED
 	xymorg::SWITCHES		Instruments;										//  Active instruments
@@ -727,6 +1040,68 @@ private:
 		if (SortNode.hasAttribute("pm")) {
 			PMEn = SortNode.isAsserted("pm");
 		}
+		if (SortNode.hasAttribute("maxsplitters")) PMP.MaxStores = SortNode.getAttributeInt("maxsplitters");
+		if (SortNode.hasAttribute("maxinc")) PMP.MaxInc = SortNode.getAttributeInt("maxinc");
+		if (SortNode.hasAttribute("pmmerge")) PMP.MergeCount = SortNode.getAttributeInt("pmmerge");
+		if (SortNode.hasAttribute("pmcount")) PMP.PatternCount = SortNode.getAttributeInt("pmcount");
+		if (SortNode.hasAttribute("pmbudget")) PMP.BudgetMB = SortNode.getAttributeInt("pmbudget");
+		PMP.Background = SortNode.isAsserted("pmbackground");
+		if (SortNode.hasAttribute("pmquantum")) PMP.Quantum = SortNode.getAttributeInt("pmquantum");
+		if (SortNode.hasAttribute("pmtier")) PMP.TierStores = SortNode.getAttributeInt("pmtier");
+		if (SortNode.hasAttribute("pmratio")) PMP.TierRatio = SortNode.getAttributeInt("pmratio");
+		if (SortNode.hasAttribute("pmpolicy")) {
+			size_t			PolicyLen = 0;												//  Length of the policy name
+			const char*		pPolicy = SortNode.getAttribute("pmpolicy", PolicyLen);		//  Policy name
+
+			if (!PMP.setStrategy(pPolicy, PolicyLen)) {
+				Log << "ERROR: The preemptive merge policy: '" << std::string(pPolicy, PolicyLen) << "' is not recognised." << std::endl;
+				ConfigValid = false;
+			}
+		}
+
+		//  Get the number of final merge threads (if specified)
+		if (SortNode.hasAttribute("threads")) {
+			Threads = SortNode.getAttributeInt("threads");
+		}
+
+		//  Get the partitioned merge threshold (if specified)
+		if (SortNode.hasAttribute("mpmin")) {
+			MPMin = SortNode.getAttributeInt("mpmin");
+		}
+
+		//  Determine if the final merge is streamed
+		SFM = SortNode.isAsserted("streamfm");
+		SzFM = SortNode.isAsserted("sizedfm");
+		SKP = SortNode.isAsserted("keyprefix");
+		Runs = SortNode.isAsserted("runs");
+		Part = SortNode.isAsserted("partitioned");
+		Chunked = SortNode.isAsserted("chunked");
+		Finger = SortNode.isAsserted("finger");
+		CPfx = SortNode.isAsserted("commonprefix");
+
+		//  Determine the sort record format (if specified)
+		if (SortNode.hasAttribute("records")) {
+			size_t			FormatLen = 0;												//  Length of the format name
+			const char*		pFormat = SortNode.getAttribute("records", FormatLen);		//  Format name
+
+			if ((FormatLen == 7) && (_memicmp(pFormat, "pointer", 7) == 0)) PtrRecs = true;
+			else if ((FormatLen == 5) && (_memicmp(pFormat, "index", 5) == 0)) IdxRecs = true;
+			else if ((FormatLen != 8) || (_memicmp(pFormat, "standard", 8) != 0)) {
+				Log << "ERROR: The sort record format: '" << std::string(pFormat, FormatLen) << "' is not recognised." << std::endl;
+				ConfigValid = false;
+			}
+		}
+
+		//  Determine the kernel level (if specified)
+		if (SortNode.hasAttribute("isa")) {
+			size_t			LevelLen = 0;												//  Length of the level name
+			const char*		pLevel = SortNode.getAttribute("isa", LevelLen);			//  Level name
+
+			if (!CPUDispatch::setLevel(pLevel, LevelLen, ISA)) {
+				Log << "ERROR: The kernel level: '" << std::string(pLevel, LevelLen) << "' is not recognised." << std::endl;
+				ConfigValid = false;
+			}
+		}
 
 		//  Capture the sortin and sortout file names
 		InFile = captureFilename(SortNode, "sortin");
@@ -813,6 +1188,85 @@ private:
 				}
 			}
 
+			//  PM trigger (-pms:s)
+			if (strlen(argv[SWX]) > 5) {
+				if (_memicmp(argv[SWX], "-pms:", 5) == 0) {
+					PMP.MaxStores = atoi(argv[SWX] + 5);
+					SWValid = true;
+				}
+			}
+
+			//  PM trigger increment (-pmi:i)
+			if (strlen(argv[SWX]) > 5) {
+				if (_memicmp(argv[SWX], "-pmi:", 5) == 0) {
+					PMP.MaxInc = atoi(argv[SWX] + 5);
+					SWValid = true;
+				}
+			}
+
+			//  PM pattern merge count (-pmm:m)
+			if (strlen(argv[SWX]) > 5) {
+				if (_memicmp(argv[SWX], "-pmm:", 5) == 0) {
+					PMP.MergeCount = atoi(argv[SWX] + 5);
+					SWValid = true;
+				}
+			}
+
+			//  PM pattern count (-pmn:n)
+			if (strlen(argv[SWX]) > 5) {
+				if (_memicmp(argv[SWX], "-pmn:", 5) == 0) {
+					PMP.PatternCount = atoi(argv[SWX] + 5);
+					SWValid = true;
+				}
+			}
+
+			//  PM budget (-pmb:b)
+			if (strlen(argv[SWX]) > 5) {
+				if (_memicmp(argv[SWX], "-pmb:", 5) == 0) {
+					PMP.BudgetMB = atoi(argv[SWX] + 5);
+					SWValid = true;
+				}
+			}
+
+			//  Background PM (-pmbg)
+			if (strlen(argv[SWX]) == 5) {
+				if (_memicmp(argv[SWX], "-pmbg", 5) == 0) {
+					PMP.Background = true;
+					SWValid = true;
+				}
+			}
+
+			//  Amortised PM quantum (-pmq:q)
+			if (strlen(argv[SWX]) > 5) {
+				if (_memicmp(argv[SWX], "-pmq:", 5) == 0) {
+					PMP.Quantum = atoi(argv[SWX] + 5);
+					SWValid = true;
+				}
+			}
+
+			//  LSM tier stores (-pmt:n)
+			if (strlen(argv[SWX]) > 5) {
+				if (_memicmp(argv[SWX], "-pmt:", 5) == 0) {
+					PMP.TierStores = atoi(argv[SWX] + 5);
+					SWValid = true;
+				}
+			}
+
+			//  LSM tier ratio (-pmr:f)
+			if (strlen(argv[SWX]) > 5) {
+				if (_memicmp(argv[SWX], "-pmr:", 5) == 0) {
+					PMP.TierRatio = atoi(argv[SWX] + 5);
+					SWValid = true;
+				}
+			}
+
+			//  PM strategy (-pmp:p)
+			if (strlen(argv[SWX]) > 5) {
+				if (_memicmp(argv[SWX], "-pmp:", 5) == 0) {
+					if (PMP.setStrategy(argv[SWX] + 5, strlen(argv[SWX] + 5))) SWValid = true;
+				}
+			}
+
 			//  Use in-memory sort model (-inmem)
 			if (strlen(argv[SWX]) == 6) {
 				if (_memicmp(argv[SWX], "-inmem", 6) == 0) {
@@ -853,6 +1307,109 @@ private:
 				}
 			}
 
+			//  Final merge threads (-threads:t)
+			if (strlen(argv[SWX]) > 9) {
+				if (_memicmp(argv[SWX], "-threads:", 9) == 0) {
+					Threads = atoi(argv[SWX] + 9);
+					SWValid = true;
+				}
+			}
+
+			//  Partitioned merge threshold (-mpmin:m)
+			if (strlen(argv[SWX]) > 7) {
+				if (_memicmp(argv[SWX], "-mpmin:", 7) == 0) {
+					MPMin = atoi(argv[SWX] + 7);
+					SWValid = true;
+				}
+			}
+
+			//  Streamed final merge (-sfm)
+			if (strlen(argv[SWX]) == 4) {
+				if (_memicmp(argv[SWX], "-sfm", 4) == 0) {
+					SFM = true;
+					SWValid = true;
+				}
+			}
+
+			//  Size ordered final merge (-sizedfm)
+			if (strlen(argv[SWX]) == 8) {
+				if (_memicmp(argv[SWX], "-sizedfm", 8) == 0) {
+					SzFM = true;
+					SWValid = true;
+				}
+			}
+
+			//  Inline sort key prefix (-skp)
+			if (strlen(argv[SWX]) == 4) {
+				if (_memicmp(argv[SWX], "-skp", 4) == 0) {
+					SKP = true;
+					SWValid = true;
+				}
+			}
+
+			//  Run detection (-runs)
+			if (strlen(argv[SWX]) == 5) {
+				if (_memicmp(argv[SWX], "-runs", 5) == 0) {
+					Runs = true;
+					SWValid = true;
+				}
+			}
+
+			//  Range partitioned sort (-part)
+			if (strlen(argv[SWX]) == 5) {
+				if (_memicmp(argv[SWX], "-part", 5) == 0) {
+					Part = true;
+					SWValid = true;
+				}
+			}
+
+			//  Chunked sort (-chunked)
+			if (strlen(argv[SWX]) == 8) {
+				if (_memicmp(argv[SWX], "-chunked", 8) == 0) {
+					Chunked = true;
+					SWValid = true;
+				}
+			}
+
+			//  Finger search of the store chain (-finger)
+			if (strlen(argv[SWX]) == 7) {
+				if (_memicmp(argv[SWX], "-finger", 7) == 0) {
+					Finger = true;
+					SWValid = true;
+				}
+			}
+
+			//  Compact pointer sort records (-srp)
+			if (strlen(argv[SWX]) == 4) {
+				if (_memicmp(argv[SWX], "-srp", 4) == 0) {
+					PtrRecs = true;
+					SWValid = true;
+				}
+			}
+
+			//  Compact index sort records (-sri)
+			if (strlen(argv[SWX]) == 4) {
+				if (_memicmp(argv[SWX], "-sri", 4) == 0) {
+					IdxRecs = true;
+					SWValid = true;
+				}
+			}
+
+			//  Kernel level (-isa:l)
+			if (strlen(argv[SWX]) > 5) {
+				if (_memicmp(argv[SWX], "-isa:", 5) == 0) {
+					if (CPUDispatch::setLevel(argv[SWX] + 5, strlen(argv[SWX] + 5), ISA)) SWValid = true;
+				}
+			}
+
+			//  Common sort key prefix elimination (-skcp)
+			if (strlen(argv[SWX]) == 5) {
+				if (_memicmp(argv[SWX], "-skcp", 5) == 0) {
+					CPfx = true;
+					SWValid = true;
+				}
+			}
+
 			//  Sort Sequence Ascending (-ska)
 			if (strlen(argv[SWX]) == 4) {
 				if (_memicmp(argv[SWX], "-ska", 4) == 0) {
@@ -941,6 +1498,22 @@ private:
 		//  Check max record length
 		if (MaxRecl < (16 * 1024)) MaxRecl = (16 * 1024);
 
+		//  Check the preemptive merge policy parameters
+		if (!PMP.isValid()) {
+			Log << "ERROR: The preemptive merge parameters are not valid (s: " << PMP.MaxStores << ", m/n: " << PMP.MergeCount << "/" << PMP.PatternCount << ", budget: " << PMP.BudgetMB << " MB";
+			if (PMP.Background) Log << ", background merging needs the tail or budget strategy";
+			if (PMP.Quantum > 0) Log << ", amortised merging needs the tail or budget strategy without background merging";
+			if (PMP.Strategy == PMP_LSM) Log << ", tier: " << PMP.TierStores << " stores, ratio: " << PMP.TierRatio;
+			Log << ")." << std::endl;
+			ConfigValid = false;
+		}
+
+		//  Check the number of final merge threads (negative values will have wrapped)
+		if (Threads > 1024) {
+			Log << "WARNING: The number of threads requested is not valid, the final merge will be single threaded." << std::endl;
+			Threads = 1;
+		}
+
 #ifdef INSTRUMENTED
 		//  Interval MUST be in the range 10 - 1000000
 		if (Interval < 10) Interval = 10;
@@ -2,7 +2,7 @@
 //*																													*
 //*   File:       UGSort.cpp																						*
 //*   Suite:      Experimental Algorithms																			*
-//*   Version:    1.17.0	(Build: 20)																				*
+//*   Version:    1.42.0	(Build: 46)																				*
 //*   Author:     Ian Tree/HMNL																						*
 //*																													*
 //*   Copyright 2017 - 2026 Ian J. Tree																				*
@@ -30,13 +30,33 @@
 //*			-inmem			Use in-memory sorting model																*
 //*			-ondisk			Use on-disk sorting model																*
 //*			-pms:s			Specifies the maximum number of splitters allowed before PM is triggered				*
+//*			-pmi:i			Specifies the percentage of 2*sqrt(n/2) splitters that triggers the following PMs		*
 //*			-pmm:m			Specifies the merge count of the preemptive merge pattern								*
 //*			-pmn:n			Specifies the count of the preemptive merge pattern, pm will merge m/n splitters		*
+//*			-pmp:p			Specifies the PM strategy: tail, head, alternate, tiered, budget or lsm					*
+//*			-pmb:b			Specifies the store overhead budget (MB) for the budget PM strategy						*
+//*			-pmbg			Merges the tail in a background thread (tail and budget PM strategies, in-memory only)	*
+//*			-pmq:q			Amortises the tail PM, each insertion moves at most q records (in-memory only)			*
+//*			-pmt:n			Specifies the number of adjacent stores allowed in a tier for the lsm PM strategy		*
+//*			-pmr:f			Specifies the size ratio between tiers for the lsm PM strategy							*
 //*			-skoffset:o		Specifies the offset in the records to the sort key										*
 //*			-sklen:l		Specifies the length of the sort key													*
 //*			-ska			Specifies that the sort sequence is ascending											*
 //*			-skd			Specifies that the sort sequence is descending											*
 //*			-sks			Specifies that the record sequence is preserved (stable) for identical keys				*
+//*			-threads:t		Specifies the number of threads to use for the final merge (0 = all cores)				*
+//*			-mpmin:m		Specifies the minimum records in a single merge for it to be split across threads		*
+//*			-sfm			Streams a k-way final merge directly into the sort output								*
+//*			-sizedfm		Final merge always merges the adjacent pair of stores with the fewest records next		*
+//*			-skp			Holds the first 8 bytes of the key inline in each sort record							*
+//*			-runs			Detects runs in the (in-memory) sort input and adds each run in one copy				*
+//*			-part			Range partitions an in-memory sort, one partition is sorted on each thread				*
+//*			-chunked		Splits an in-memory sort into contiguous chunks, one chunk is sorted on each thread		*
+//*			-finger			Searches for the store to receive each key outwards from the previous key's store		*
+//*			-srp			Uses compact sort records that hold only a pointer to the key (8 bytes in-memory)		*
+//*			-sri			Uses compact sort records that hold only the offset of the record (4 or 5 bytes)		*
+//*			-isa:l			Forces the kernel level: auto, scalar, sse4.2, avx2 or avx512 (default: auto)			*
+//*			-skcp			Eliminates the prefix common to every sort key, only the remainder is compared			*
 //*																													*
 //*	NOTES:																											*
 //*																													*
@@ -66,6 +86,31 @@
 //*	1.16.1 -	19/10/2023	-	Increase PM timer resolution														*
 //*	1.16.2 -	18/11/2024	-	Headers sanitized for gcc 8.5														*
 //*	1.17.0 -	28/01/2026	-	Include instrumentation package														*
+//*	1.18.0 -	16/10/2026	-	Multi-threaded final merge															*
+//*	1.19.0 -	16/10/2026	-	Merge-path partitioned merges														*
+//*	1.20.0 -	16/10/2026	-	Streamed k-way (loser tree) final merge												*
+//*	1.21.0 -	16/10/2026	-	Ping-pong merge buffers for the final merge											*
+//*	1.22.0 -	16/10/2026	-	Inline key prefix in sort records													*
+//*	1.23.0 -	16/10/2026	-	Comparator policy template parameter												*
+//*	1.24.0 -	16/10/2026	-	Boundary key index for the binary chop												*
+//*	1.25.0 -	16/10/2026	-	Natural run detection with bulk insertion											*
+//*	1.26.0 -	16/10/2026	-	Range partitioned parallel sort														*
+//*	1.27.0 -	16/10/2026	-	Chunk parallel sort with store adoption												*
+//*	1.28.0 -	16/10/2026	-	Selectable preemptive merge policy													*
+//*	1.29.0 -	16/10/2026	-	Single pass k-way tail suppression													*
+//*	1.30.0 -	16/10/2026	-	Size ordered final merge schedule													*
+//*	1.31.0 -	16/10/2026	-	Background preemptive merge															*
+//*	1.32.0 -	16/10/2026	-	Amortised preemptive merge															*
+//*	1.33.0 -	16/10/2026	-	Size tiered store compaction														*
+//*	1.34.0 -	16/10/2026	-	Slab pool allocation of stores and initial SRAs										*
+//*	1.35.0 -	16/10/2026	-	Segmented double ended SRA storage													*
+//*	1.36.0 -	16/10/2026	-	Finger search of the store chain													*
+//*	1.37.0 -	16/10/2026	-	Compact sort record formats															*
+//*	1.38.0 -	16/10/2026	-	Galloping and block copy merge kernels												*
+//*	1.39.0 -	16/10/2026	-	Branchless merge kernel																*
+//*	1.40.0 -	16/10/2026	-	Runtime processor feature dispatch													*
+//*	1.41.0 -	16/10/2026	-	Vector key compare kernels															*
+//*	1.42.0 -	16/10/2026	-	Common sort key prefix elimination													*
 //*																													*
 //*******************************************************************************************************************/
 
@@ -84,8 +129,16 @@ int main(int argc, char* argv[])
 		return EXIT_FAILURE;
 	}
 
+	//  Select the kernels for the processor (or the forced level)
+	CPUDispatch::select(Config.getISALevel());
+
 	//  Show that program is starting 
-	Config.Log << APP_TITLE << " (" << APP_NAME << ") Version: " << APP_VERSION << " is starting." << std::endl;
+	Config.Log << APP_TITLE << " (" << APP_NAME << ") Version: " << APP_VERSION << " [kernels: " << CPUDispatch::getLevelName(CPUDispatch::getLevel())
+		<< " (" << CPUDispatch::getKernels() << "), cpu: " << CPUDispatch::getFeatures() << "] is starting." << std::endl;
+	if ((Config.getISALevel() != ISA_AUTO) && (Config.getISALevel() > CPUDispatch::getLevel())) {
+		Config.Log << "WARNING: The requested kernel level: " << CPUDispatch::getLevelName(Config.getISALevel()) << " is not supported by the processor, "
+			<< CPUDispatch::getLevelName(CPUDispatch::getLevel()) << " kernels are used." << std::endl;
+	}
 
 	//  Verify the capture of configuration variables
 	if (!Config.isValid()) {
@@ -178,6 +231,19 @@ bool	performSplitSort(UGSCfg& Config) {
 	SWiz.enableNotifications();
 	SWiz.enableTimings();
 
+	//  Set the number of threads available to the Sort Wizzard
+	SWiz.setThreads(Config.getThreads());
+	SWiz.setMergePathThreshold(Config.getMergePathThreshold());
+	if (Config.isStreamedMerge()) SWiz.enableStreamedMerge();
+	if (Config.isSizedMerge()) SWiz.enableSizedMerge();
+	if (Config.isFingerSearch()) SWiz.enableFingerSearch();
+	if (Config.isKeyPrefixEnabled()) SWiz.enableKeyPrefix();
+	if (Config.isRunInsertion()) SWiz.enableRunInsertion();
+	if (Config.isPointerRecords()) SWiz.enablePointerRecords();
+	if (Config.isIndexRecords()) SWiz.enableIndexRecords();
+	if (Config.isCommonPrefix()) SWiz.enableCommonPrefix();
+	SWiz.setPMPolicy(Config.getPMPolicy());
+
 	//
 	//  Open and close the sort output file
 	//
@@ -188,8 +254,44 @@ bool	performSplitSort(UGSCfg& Config) {
 	}
 	Sortout.close();
 
+	//  If the requested sort is to be performed in-memory and range partitioned then invoke the partitioned sort function
+	if (Config.isModelInMemory() && Config.isPartitioned()) {
+		if (SWiz.sortFilePartitioned(Config.getSortin(),
+			Config.getSortout(),
+			Config.getSortKeyOffset(),
+			Config.getSortKeyLength(),
+			Config.isSortSequenceAscending(),
+			Config.isPMEnabled(), Stats)) {
+			Config.Log << "INFO: The sort operation has completed." << std::endl;
+		}
+		else {
+#ifdef INSTRUMENTED
+			Stats.deactivateInstruments();
+#endif
+			//  Sort failed
+			return false;
+		}
+	}
+	//  If the requested sort is to be performed in-memory and chunked then invoke the chunked sort function
+	else if (Config.isModelInMemory() && Config.isChunked()) {
+		if (SWiz.sortFileChunked(Config.getSortin(),
+			Config.getSortout(),
+			Config.getSortKeyOffset(),
+			Config.getSortKeyLength(),
+			Config.isSortSequenceAscending(),
+			Config.isPMEnabled(), Stats)) {
+			Config.Log << "INFO: The sort operation has completed." << std::endl;
+		}
+		else {
+#ifdef INSTRUMENTED
+			Stats.deactivateInstruments();
+#endif
+			//  Sort failed
+			return false;
+		}
+	}
 	//  If the requested sort is to be performed in-memory then invoke the appropriate sort function
-	if (Config.isModelInMemory()) {
+	else if (Config.isModelInMemory()) {
 		if (SWiz.sortFileInMemory(Config.getSortin(),
 			Config.getSortout(),
 			Config.getSortKeyOffset(),
@@ -283,6 +385,19 @@ bool	performStableSplitSort(UGSCfg& Config) {
 	SWiz.enableNotifications();
 	SWiz.enableTimings();
 
+	//  Set the number of threads available to the Sort Wizzard
+	SWiz.setThreads(Config.getThreads());
+	SWiz.setMergePathThreshold(Config.getMergePathThreshold());
+	if (Config.isStreamedMerge()) SWiz.enableStreamedMerge();
+	if (Config.isSizedMerge()) SWiz.enableSizedMerge();
+	if (Config.isFingerSearch()) SWiz.enableFingerSearch();
+	if (Config.isKeyPrefixEnabled()) SWiz.enableKeyPrefix();
+	if (Config.isRunInsertion()) SWiz.enableRunInsertion();
+	if (Config.isPointerRecords()) SWiz.enablePointerRecords();
+	if (Config.isIndexRecords()) SWiz.enableIndexRecords();
+	if (Config.isCommonPrefix()) SWiz.enableCommonPrefix();
+	SWiz.setPMPolicy(Config.getPMPolicy());
+
 	//
 	//  Open and close the sort output file
 	//
@@ -293,8 +408,44 @@ bool	performStableSplitSort(UGSCfg& Config) {
 	}
 	Sortout.close();
 
+	//  If the requested sort is to be performed in-memory and range partitioned then invoke the partitioned sort function
+	if (Config.isModelInMemory() && Config.isPartitioned()) {
+		if (SWiz.sortStableFilePartitioned(Config.getSortin(),
+			Config.getSortout(),
+			Config.getSortKeyOffset(),
+			Config.getSortKeyLength(),
+			Config.isSortSequenceAscending(),
+			Config.isPMEnabled(), Stats)) {
+			Config.Log << "INFO: The sort operation has completed." << std::endl;
+		}
+		else {
+#ifdef INSTRUMENTED
+			Stats.deactivateInstruments();
+#endif
+			//  Sort failed
+			return false;
+		}
+	}
+	//  If the requested sort is to be performed in-memory and chunked then invoke the chunked sort function
+	else if (Config.isModelInMemory() && Config.isChunked()) {
+		if (SWiz.sortStableFileChunked(Config.getSortin(),
+			Config.getSortout(),
+			Config.getSortKeyOffset(),
+			Config.getSortKeyLength(),
+			Config.isSortSequenceAscending(),
+			Config.isPMEnabled(), Stats)) {
+			Config.Log << "INFO: The sort operation has completed." << std::endl;
+		}
+		else {
+#ifdef INSTRUMENTED
+			Stats.deactivateInstruments();
+#endif
+			//  Sort failed
+			return false;
+		}
+	}
 	//  If the requested sort is to be performed in-memory then invoke the appropriate sort function
-	if (Config.isModelInMemory()) {
+	else if (Config.isModelInMemory()) {
 		if (SWiz.sortStableFileInMemory(Config.getSortin(),
 			Config.getSortout(),
 			Config.getSortKeyOffset(),
@@ -410,9 +561,49 @@ bool		establishRunConfig(UGSCfg& Config) {
 	//  Indicate the preemptive merging settings
 	if (Config.isPMEnabled()) {
 		Config.Log << "INFO: Preemptive merging is enabled." << std::endl;
+		Config.Log << "INFO: The preemptive merge strategy is: " << PMPolicy::getStrategyName(Config.getPMPolicy().Strategy);
+		if (Config.getPMPolicy().Strategy == PMP_BUDGET) Config.Log << ", budget: " << Config.getPMPolicy().BudgetMB << " MB";
+		else if (Config.getPMPolicy().Strategy == PMP_LSM) Config.Log << ", tier: " << Config.getPMPolicy().TierStores << " stores, ratio: " << Config.getPMPolicy().TierRatio;
+		else Config.Log << ", trigger: " << Config.getPMPolicy().MaxStores << " stores, increment: " << Config.getPMPolicy().MaxInc << "%";
+		if (Config.getPMPolicy().Strategy != PMP_ALTERNATE && Config.getPMPolicy().Strategy != PMP_LSM) Config.Log << ", merging: " << Config.getPMPolicy().MergeCount << "/" << Config.getPMPolicy().PatternCount;
+		if (Config.getPMPolicy().Background && Config.isModelInMemory()) Config.Log << ", in the background";
+		if (Config.getPMPolicy().Quantum > 0 && Config.isModelInMemory()) Config.Log << ", amortised over: " << Config.getPMPolicy().Quantum << " records per insert";
+		Config.Log << "." << std::endl;
 	}
 	else Config.Log << "INFO: Preemptive merging is NOT enabled." << std::endl;
 
+	//  Report the final merge mode
+	if (Config.isStreamedMerge()) Config.Log << "INFO: The final merge will be a k-way merge streamed into the sort output." << std::endl;
+	else if (Config.isSizedMerge()) Config.Log << "INFO: The final merge will always merge the adjacent pair of stores with the fewest records next." << std::endl;
+	if (Config.isKeyPrefixEnabled()) Config.Log << "INFO: Sort records will hold an inline 8 byte key prefix." << std::endl;
+	if (Config.isRunInsertion()) Config.Log << "INFO: Runs in the sort input will be detected and added to the stores in blocks." << std::endl;
+	if (Config.isFingerSearch()) Config.Log << "INFO: The store chain will be searched outwards from the store that received the previous key." << std::endl;
+	if (Config.isCommonPrefix()) Config.Log << "INFO: The prefix common to every sort key will be eliminated." << std::endl;
+
+	//  Report the sort record layout
+	if (Config.isKeyPrefixEnabled()) {
+		if (Config.isPointerRecords() || Config.isIndexRecords()) Config.Log << "INFO: Compact sort records are not used with the inline key prefix." << std::endl;
+	}
+	else if (Config.isModelInMemory() && (Config.isPartitioned() || Config.isChunked())) {
+		if (Config.isPointerRecords() || Config.isIndexRecords()) Config.Log << "INFO: Compact sort records are not used by partitioned or chunked sorts." << std::endl;
+	}
+	else if (Config.isIndexRecords() && Config.isModelInMemory()) {
+		if (SISize < INDEX32_LIMIT) Config.Log << "INFO: Sort records will be 4 byte record offsets." << std::endl;
+		else if (SISize < INDEX40_LIMIT) Config.Log << "INFO: Sort records will be 5 byte record offsets." << std::endl;
+		else Config.Log << "INFO: Sort records will be 8 byte key pointers." << std::endl;
+	}
+	else if (Config.isPointerRecords() || Config.isIndexRecords()) {
+		if (Config.isModelInMemory()) Config.Log << "INFO: Sort records will be 8 byte key pointers." << std::endl;
+		else Config.Log << "INFO: Sort records will be 16 byte key pointers with 64 bit record positions." << std::endl;
+	}
+	if (Config.isModelInMemory() && Config.isPartitioned()) Config.Log << "INFO: The sort input will be range partitioned, one partition will be sorted on each thread." << std::endl;
+	else if (Config.isModelInMemory() && Config.isChunked()) Config.Log << "INFO: The sort input will be split into contiguous chunks, one chunk will be sorted on each thread." << std::endl;
+
+	//  Report the final merge threading
+	if (Config.getThreads() == 0) Config.Log << "INFO: The final merge will use all available threads (" << std::thread::hardware_concurrency() << ")." << std::endl;
+	else if (Config.getThreads() > 1) Config.Log << "INFO: The final merge will use: " << Config.getThreads() << " threads." << std::endl;
+	if (Config.getThreads() != 1) Config.Log << "INFO: Final merges of: " << Config.getMergePathThreshold() << " records or more will be partitioned across the threads." << std::endl;
+
 #ifdef INSTRUMENTED
 	//  Determine if there is a valid pile-up instrument file, if so update the file name (from relative to actual)
 	if (Config.getInstruments() & INSTRUMENT_PILEUP) {
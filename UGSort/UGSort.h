@@ -3,7 +3,7 @@
 //*																													*
 //*   File:       UGSort.h																							*
 //*   Suite:      Experimental Algorithms																			*
-//*   Version:    1.17.1	(Build: 21)																				*
+//*   Version:    1.42.0	(Build: 46)																				*
 //*   Author:     Ian Tree/HMNL																						*
 //*																													*
 //*   Copyright 2017 - 2026 Ian J. Tree																				*
@@ -31,13 +31,33 @@
 //*			-inmem			Use in-memory sorting model																*
 //*			-ondisk			Use on-disk sorting model																*
 //*			-pms:s			Specifies the maximum number of splitters allowed before PM is triggered				*
+//*			-pmi:i			Specifies the percentage of 2*sqrt(n/2) splitters that triggers the following PMs		*
 //*			-pmm:m			Specifies the merge count of the preemptive merge pattern								*
 //*			-pmn:n			Specifies the count of the preemptive merge pattern, pm will merge m/n splitters		*
+//*			-pmp:p			Specifies the PM strategy: tail, head, alternate, tiered, budget or lsm					*
+//*			-pmb:b			Specifies the store overhead budget (MB) for the budget PM strategy						*
+//*			-pmbg			Merges the tail in a background thread (tail and budget PM strategies, in-memory only)	*
+//*			-pmq:q			Amortises the tail PM, each insertion moves at most q records (in-memory only)			*
+//*			-pmt:n			Specifies the number of adjacent stores allowed in a tier for the lsm PM strategy		*
+//*			-pmr:f			Specifies the size ratio between tiers for the lsm PM strategy							*
 //*			-skoffset:o		Specifies the offset in the records to the sort key										*
 //*			-sklen:l		Specifies the length of the sort key													*
 //*			-ska			Specifies that the sort sequence is ascending											*
 //*			-skd			Specifies that the sort sequence is descending											*
 //*			-sks			Specifies that the record sequence is preserved (stable) for identical keys				*
+//*			-threads:t		Specifies the number of threads to use for the final merge (0 = all cores)				*
+//*			-mpmin:m		Specifies the minimum records in a single merge for it to be split across threads		*
+//*			-sfm			Streams a k-way final merge directly into the sort output								*
+//*			-sizedfm		Final merge always merges the adjacent pair of stores with the fewest records next		*
+//*			-skp			Holds the first 8 bytes of the key inline in each sort record							*
+//*			-runs			Detects runs in the (in-memory) sort input and adds each run in one copy				*
+//*			-part			Range partitions an in-memory sort, one partition is sorted on each thread				*
+//*			-chunked		Splits an in-memory sort into contiguous chunks, one chunk is sorted on each thread		*
+//*			-finger			Searches for the store to receive each key outwards from the previous key's store		*
+//*			-srp			Uses compact sort records that hold only a pointer to the key (8 bytes in-memory)		*
+//*			-sri			Uses compact sort records that hold only the offset of the record (4 or 5 bytes)		*
+//*			-isa:l			Forces the kernel level: auto, scalar, sse4.2, avx2 or avx512 (default: auto)			*
+//*			-skcp			Eliminates the prefix common to every sort key, only the remainder is compared			*
 //*																													*
 //*	NOTES:																											*
 //*																													*
@@ -68,6 +88,31 @@
 //*	1.16.2 -	18/11/2024	-	Headers sanitized for gcc 8.5														*
 //*	1.17.0 -	28/01/2026	-	Include instrumentation package														*
 //*	1.17.1 -	31/01/2026	-	Tidy up for Linux Compatability														*
+//*	1.18.0 -	16/10/2026	-	Multi-threaded final merge															*
+//*	1.19.0 -	16/10/2026	-	Merge-path partitioned merges														*
+//*	1.20.0 -	16/10/2026	-	Streamed k-way (loser tree) final merge												*
+//*	1.21.0 -	16/10/2026	-	Ping-pong merge buffers for the final merge											*
+//*	1.22.0 -	16/10/2026	-	Inline key prefix in sort records													*
+//*	1.23.0 -	16/10/2026	-	Comparator policy template parameter												*
+//*	1.24.0 -	16/10/2026	-	Boundary key index for the binary chop												*
+//*	1.25.0 -	16/10/2026	-	Natural run detection with bulk insertion											*
+//*	1.26.0 -	16/10/2026	-	Range partitioned parallel sort														*
+//*	1.27.0 -	16/10/2026	-	Chunk parallel sort with store adoption												*
+//*	1.28.0 -	16/10/2026	-	Selectable preemptive merge policy													*
+//*	1.29.0 -	16/10/2026	-	Single pass k-way tail suppression													*
+//*	1.30.0 -	16/10/2026	-	Size ordered final merge schedule													*
+//*	1.31.0 -	16/10/2026	-	Background preemptive merge															*
+//*	1.32.0 -	16/10/2026	-	Amortised preemptive merge															*
+//*	1.33.0 -	16/10/2026	-	Size tiered store compaction														*
+//*	1.34.0 -	16/10/2026	-	Slab pool allocation of stores and initial SRAs										*
+//*	1.35.0 -	16/10/2026	-	Segmented double ended SRA storage													*
+//*	1.36.0 -	16/10/2026	-	Finger search of the store chain													*
+//*	1.37.0 -	16/10/2026	-	Compact sort record formats															*
+//*	1.38.0 -	16/10/2026	-	Galloping and block copy merge kernels												*
+//*	1.39.0 -	16/10/2026	-	Branchless merge kernel																*
+//*	1.40.0 -	16/10/2026	-	Runtime processor feature dispatch													*
+//*	1.41.0 -	16/10/2026	-	Vector key compare kernels															*
+//*	1.42.0 -	16/10/2026	-	Common sort key prefix elimination													*
 //*																													*
 //*******************************************************************************************************************/
 
@@ -82,9 +127,9 @@
 #define		APP_NAME			"UGSort"
 #define		APP_TITLE			"UGSort Algorithm Testbed"
 #ifdef _DEBUG
-#define		APP_VERSION			"1.17.1 build: 21 Debug"
+#define		APP_VERSION			"1.42.0 build: 46 Debug"
 #else
-#define		APP_VERSION			"1.17.1 build: 21"
+#define		APP_VERSION			"1.42.0 build: 46"
 #endif
 
 //  Forward Declarations/ Function Prototypes
@@ -0,0 +1,285 @@
+#pragma once
+//*******************************************************************************************************************
+//*																													*
+//*   File:       WorkerPool.h																						*
+//*   Suite:      Experimental Algorithms																			*
+//*   Version:    1.18.0	(Build: 22)																				*
+//*   Author:     Ian Tree/HMNL																						*
+//*																													*
+//*   Copyright 2017 - 2026 Ian J. Tree																				*
+//*******************************************************************************************************************
+//*																													*
+//*	This header file contains the definition for the WorkerPool class.												*
+//* The WorkerPool provides a simple fork/join facility for running a batch of independent tasks concurrently.		*
+//* The helper threads are started once when the pool is constructed and wait for work between batches. A batch		*
+//* of tasks is dispatched to the pool, tasks are claimed by the helpers (and the dispatching thread) from a shared	*
+//* counter and the dispatch returns when every task in the batch has completed.									*
+//*																													*
+//*	NOTES:																											*
+//*																													*
+//*	1.	Tasks in a batch MUST be independent of each other, no ordering between tasks is implied.					*
+//*	2.	A pool with a single thread runs every task inline on the dispatching thread.								*
+//*	3.	Batches MUST be dispatched from one thread at a time, a task MUST NOT dispatch to its own pool.				*
+//*																													*
+//*******************************************************************************************************************
+//*																													*
+//*   History:																										*
+//*																													*
+//*	1.18.0 -	16/10/2026	-	Initial Release																		*
+//*																													*
+//*******************************************************************************************************************/
+
+//  Include xymorg headers
+#include	"../xymorg/xymorg.h"															//  xymorg system headers
+
+//  Standard headers
+#include	<mutex>																			//  Batch hand-off lock
+#include	<condition_variable>															//  Batch hand-off signals
+
+//
+//		WorkerPool Class definition
+//
+
+class WorkerPool {
+public:
+	//*******************************************************************************************************************
+	//*                                                                                                                 *
+	//*   Constructors			                                                                                        *
+	//*                                                                                                                 *
+	//*******************************************************************************************************************
+
+	//  Constructor
+	//
+	//  Constructs the WorkerPool with the requested number of threads, the helper threads are started
+	//
+	//  PARAMETERS:
+	//
+	//		size_t			-		Number of threads (including the dispatching thread), 0 = hardware concurrency
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+
+	WorkerPool(size_t Threads) : PoolSize(Threads), Helpers(0), pHelpers(nullptr), pBatch(nullptr), pRun(nullptr), BatchTasks(0), NextTask(0), Busy(0), Generation(0), Stopping(false) {
+
+		//  Resolve the pool size from the hardware if not specified
+		if (PoolSize == 0) PoolSize = size_t(std::thread::hardware_concurrency());
+		if (PoolSize == 0) PoolSize = 1;
+
+		//  Start the helper threads, the dispatching thread is the remaining member of the pool
+		Helpers = PoolSize - 1;
+		if (Helpers > 0) pHelpers = new std::thread[Helpers];
+		for (size_t hIndex = 0; hIndex < Helpers; hIndex++) pHelpers[hIndex] = std::thread(&WorkerPool::helper, this);
+
+		//  Return to caller
+		return;
+	}
+
+	//*******************************************************************************************************************
+	//*                                                                                                                 *
+	//*   Destructor			                                                                                        *
+	//*                                                                                                                 *
+	//*******************************************************************************************************************
+
+	//  Destructor
+	//
+	//  Destroys the WorkerPool, the helper threads are stopped and joined
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+
+	~WorkerPool() {
+
+		//  Signal the helpers to stop and wait for them to finish
+		{
+			std::lock_guard<std::mutex>		Guard(Lock);
+			Stopping = true;
+		}
+		Wake.notify_all();
+		for (size_t hIndex = 0; hIndex < Helpers; hIndex++) pHelpers[hIndex].join();
+		if (pHelpers != nullptr) delete[] pHelpers;
+
+		//  Return to caller
+		return;
+	}
+
+	//*******************************************************************************************************************
+	//*                                                                                                                 *
+	//*   Public Functions                                                                                              *
+	//*                                                                                                                 *
+	//*******************************************************************************************************************
+
+	//  getThreads
+	//
+	//  Returns the number of threads in the pool
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//		size_t		-		Number of threads
+	//
+	//  NOTES:
+	//
+
+	size_t	getThreads() const { return PoolSize; }
+
+	//  dispatch
+	//
+	//  Runs a batch of tasks across the pool and waits for all of them to complete
+	//
+	//  PARAMETERS:
+	//
+	//		size_t		-		Number of tasks in the batch
+	//		F			-		Callable invoked as Task(size_t TaskNo) for each task in the batch
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+	//	1.	The dispatching thread participates in running the batch.
+	//	2.	A batch of a single task (or a pool without helpers) is run inline without waking the helpers.
+	//
+
+	template <typename F>
+	void	dispatch(size_t Tasks, F Task) {
+
+		if (Tasks == 0) return;
+
+		//  Run the batch inline if there is nothing to share
+		if (Helpers == 0 || Tasks == 1) {
+			for (size_t TaskNo = 0; TaskNo < Tasks; TaskNo++) Task(TaskNo);
+			return;
+		}
+
+		//  Publish the batch and wake the helpers
+		{
+			std::lock_guard<std::mutex>		Guard(Lock);
+			pBatch = &Task;
+			pRun = &runTask<F>;
+			BatchTasks = Tasks;
+			NextTask.store(0);
+			Busy = Helpers;
+			Generation++;
+		}
+		Wake.notify_all();
+
+		//  Run tasks on this thread and then wait for the helpers to finish the batch
+		work();
+		{
+			std::unique_lock<std::mutex>	Guard(Lock);
+			Done.wait(Guard, [this]() { return Busy == 0; });
+			pBatch = nullptr;
+			pRun = nullptr;
+		}
+
+		//  Return to caller
+		return;
+	}
+
+private:
+
+	//*******************************************************************************************************************
+	//*                                                                                                                 *
+	//*   Private Members			                                                                                    *
+	//*                                                                                                                 *
+	//*******************************************************************************************************************
+
+	size_t					PoolSize;														//  Number of threads in the pool
+	size_t					Helpers;														//  Number of helper threads
+	std::thread*			pHelpers;														//  Helper threads
+	std::mutex				Lock;															//  Batch hand-off lock
+	std::condition_variable	Wake;															//  Signals a new batch (or stop) to the helpers
+	std::condition_variable	Done;															//  Signals the end of a batch to the dispatcher
+	void*					pBatch;															//  Task callable of the current batch
+	void					(*pRun)(void*, size_t);											//  Invokes the task callable of the current batch
+	size_t					BatchTasks;														//  Number of tasks in the current batch
+	std::atomic<size_t>		NextTask;														//  Next task to be claimed
+	size_t					Busy;															//  Helpers still working on the current batch
+	size_t					Generation;														//  Batch sequence number
+	bool					Stopping;														//  Helpers are to stop
+
+	//*******************************************************************************************************************
+	//*                                                                                                                 *
+	//*   Private Functions                                                                                             *
+	//*                                                                                                                 *
+	//*******************************************************************************************************************
+
+	//  runTask
+	//
+	//  Invokes the task callable of a batch for a single task
+	//
+	//  PARAMETERS:
+	//
+	//		void*		-		Pointer to the task callable (F)
+	//		size_t		-		Task number
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+
+	template <typename F>
+	static void	runTask(void* pTask, size_t TaskNo) { (*((F*) pTask))(TaskNo); return; }
+
+	//  work
+	//
+	//  Claims and runs tasks from the current batch until the batch is exhausted
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+
+	void	work() {
+		size_t	TaskNo = NextTask.fetch_add(1);												//  Task claimed
+
+		while (TaskNo < BatchTasks) {
+			pRun(pBatch, TaskNo);
+			TaskNo = NextTask.fetch_add(1);
+		}
+
+		//  Return to caller
+		return;
+	}
+
+	//  helper
+	//
+	//  Body of a helper thread, waits for each batch in turn and joins in running it
+	//
+	//  PARAMETERS:
+	//
+	//  RETURNS:
+	//
+	//  NOTES:
+	//
+
+	void	helper() {
+		size_t	Seen = 0;																	//  Last batch joined
+
+		for (;;) {
+			{
+				std::unique_lock<std::mutex>	Guard(Lock);
+				Wake.wait(Guard, [this, Seen]() { return Stopping || Generation != Seen; });
+				if (Stopping) return;
+				Seen = Generation;
+			}
+
+			//  Run tasks from the batch and report completion
+			work();
+			{
+				std::lock_guard<std::mutex>		Guard(Lock);
+				Busy--;
+				if (Busy == 0) Done.notify_one();
+			}
+		}
+	}
+
+};